@@ -16,16 +16,44 @@
 #include <object.h>
 
 #include <tcl.h>
+#include <tclTomMath.h>
 
 #include <assert.h>
 #include <dlfcn.h>
+#include <limits.h>
 
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define STREQU(a, b) (*(a) == *(b) && strcmp((a), (b)) == 0)
 
+// python 3.8 had vectorcall, but it was still provisional
+#ifndef Py_TPFLAGS_HAVE_VECTORCALL
+#define Py_TPFLAGS_HAVE_VECTORCALL _Py_TPFLAGS_HAVE_VECTORCALL
+#endif
+#if PY_VERSION_HEX < 0x03090000
+#define PyObject_Vectorcall _PyObject_Vectorcall
+#define PyObject_VectorcallDict _PyObject_FastCallDict
+#endif
+// python 3.13 added a with_exceptions argument to _PyLong_AsByteArray
+#if PY_VERSION_HEX >= 0x030D0000
+#define tohil_PyLong_AsByteArray(v, bytes, n, little_endian, is_signed) \
+    _PyLong_AsByteArray((PyLongObject *)(v), (bytes), (n), (little_endian), (is_signed), 1)
+#else
+#define tohil_PyLong_AsByteArray(v, bytes, n, little_endian, is_signed) \
+    _PyLong_AsByteArray((PyLongObject *)(v), (bytes), (n), (little_endian), (is_signed))
+#endif
+// python 3.14 made hashing bytes public as Py_HashBuffer
+#if PY_VERSION_HEX >= 0x030E0000
+#define tohil_HashBytes Py_HashBuffer
+#else
+#define tohil_HashBytes _Py_HashBytes
+#endif
+
 // name we use for keeping track of python interpreter from tcl
 // using tcl's Tcl_GetAssocData and friends
 // a pointer to the python subinterpreter's associated with this tcl interpreter
@@ -38,9 +66,66 @@
 // pointer for python
 #define TCL_TCL_INTERP_CAPSULE_NAME "tohil.interp"
 
+// a small bounded, least-recently-used cache keyed by strings.
+// tohil keeps a few of these per tcl interpreter to remember
+// the results of expensive lookups and compilations.
+typedef struct TohilCacheEntry {
+    struct TohilCacheEntry *prev;
+    struct TohilCacheEntry *next;
+    Tcl_HashEntry *hashEntry;
+    void *value;
+} TohilCacheEntry;
+
+typedef struct {
+    Tcl_HashTable table;
+    TohilCacheEntry *head; // most recently used
+    TohilCacheEntry *tail; // least recently used
+    int size;
+    int limit;
+    void (*freeProc)(void *value);
+} TohilCache;
+
+// how many arguments tohil.call and friends can pass to tcl
+// from an objv on the stack before needing to allocate one
+#define TOHIL_STATIC_OBJV_SIZE 16
+
+// maximum number of resolved tohil::call function names
+// remembered per interpreter
+#define TOHIL_CALL_CACHE_SIZE 256
+
+// maximum number of compiled tohil::eval and tohil::exec
+// code objects remembered per interpreter, each
+#define TOHIL_CODE_CACHE_SIZE 128
+
+// maximum number of tohil.eval scripts and tohil.expr
+// expressions remembered per interpreter, each
+#define TOHIL_SCRIPT_CACHE_SIZE 128
+
+// maximum number of interned python strs remembered per
+// interpreter for the keys of converted dicts, and the
+// longest key, in bytes, that is worth remembering
+#define TOHIL_KEY_CACHE_SIZE 1024
+#define TOHIL_KEY_CACHE_MAX_LENGTH 64
+
+// longest tcl string, in bytes, that remembers the python str
+// it was converted to
+#define TOHIL_PYSTR_MAX_LENGTH 1024
+
+// maximum number of python types whose way of converting
+// to tcl is remembered per interpreter
+#define TOHIL_TYPE_CACHE_SIZE 512
+
 typedef struct {
     PyThreadState *parent;
     PyThreadState *child;
+    TohilCache callCache;
+    TohilCache evalCodeCache;
+    TohilCache execCodeCache;
+    TohilCache scriptCache;
+    TohilCache exprCache;
+    TohilCache keyCache;
+    Tcl_HashTable typeCache; // TohilTypeCacheEntry by python type
+    PyObject *converters;    // tohil.register_converter's, by type
 } TohilPyterps;
 
 // leave in asserts
@@ -48,6 +133,40 @@ typedef struct {
 
 // forward definitions
 
+// what a "to" type says to convert a tcl object to.  tohil_to_kind
+// works this out once, when "to" is given, so that converting
+// each of many objects doesn't have to look at the type again.
+// zero, what freshly allocated python objects have, is tclobj,
+// which is what no "to" at all means.
+enum TohilToKind {
+    TOHIL_TO_TCLOBJ = 0,
+    TOHIL_TO_FROZENTCLOBJ,
+    TOHIL_TO_STR,
+    TOHIL_TO_INT,
+    TOHIL_TO_BOOL,
+    TOHIL_TO_FLOAT,
+    TOHIL_TO_TCLDICT,
+    TOHIL_TO_LIST,
+    TOHIL_TO_SET,
+    TOHIL_TO_DICT,
+    TOHIL_TO_TUPLE,
+    TOHIL_TO_AUTO, // tohil.auto, by what tcl already knows the object to be
+    TOHIL_TO_CALLABLE,
+    TOHIL_TO_GENERIC // a generic alias, like list[int]
+};
+
+// a "to" type compiled for converting many objects, including the
+// element types of a generic alias like list[int]; see
+// tohil_to_spec_compile
+typedef struct TohilToSpec {
+    enum TohilToKind kind;
+    PyObject *to;               // the type, function or generic alias, borrowed
+    int nargs;                  // number of element specs, 0 if not generic
+    int variadic;               // tuple[X, ...], all elements are args[0]
+    int callsPython;            // converting runs python code, like a callable
+    struct TohilToSpec *args;   // element specs
+} TohilToSpec;
+
 // tclobj python data type that consists of a standard python
 // object header and then our sole addition, a pointer to
 // a Tcl_Obj.  we dig into tclobj using the tcl C api in our
@@ -55,14 +174,20 @@ typedef struct {
 typedef struct {
     PyObject_HEAD;
     PyObject *to;
+    enum TohilToKind toKind;
     Tcl_Interp *interp;
     Tcl_Obj *tclvar;
     Tcl_Obj *tclobj;
+    int exports;        // buffer exports, which refuse writes while live
+    int pinnedExports;  // those of them exporting tclobj in place
+    Tcl_Obj *readObj;   // copy to read from while tclobj is exported in place
+    Py_hash_t hash;     // frozentclobj's cached hash of the string rep, or -1
 } TohilTclObj;
 
 int TohilTclObj_Check(PyObject *pyObj);
 int TohilTclDict_Check(PyObject *pyObj);
 static PyTypeObject TohilTclObjType;
+static PyTypeObject TohilFrozenTclObjType;
 static PyTypeObject TohilTclObj_IterType;
 
 int TohilTclDict_Check(PyObject *pyObj);
@@ -75,6 +200,15 @@ static int TohilTclObj_stuff_var(TohilTclObj *self, Tcl_Obj *obj);
 static int Tohil_ReturnExceptionToTcl(Tcl_Interp *interp, PyThreadState *prior, char *description);
 
 static PyObject *tohil_python_return(Tcl_Interp *, int tcl_result, PyObject *toType, Tcl_Obj *resultObj);
+static PyObject *tohil_python_return_kind(Tcl_Interp *, int tcl_result, enum TohilToKind toKind, PyObject *toType, Tcl_Obj *resultObj);
+static enum TohilToKind tohil_to_kind(PyObject *toType);
+static PyObject *tohil_python_return_generic(Tcl_Interp *interp, PyObject *toType, Tcl_Obj *resultObj);
+static int tohil_to_spec_compile(PyObject *to, TohilToSpec *spec);
+static PyObject *tohil_to_spec_convert(Tcl_Interp *interp, TohilToSpec *spec, Tcl_Obj *obj);
+static void tohil_to_spec_free(TohilToSpec *spec);
+static PyObject *tohil_auto(PyObject *m, PyObject *pObj);
+static PyObject *tohil_TclObjToPyKey(Tcl_Interp *interp, Tcl_Obj *obj);
+static Tcl_Obj *pyObjToTcl(Tcl_Interp *interp, PyObject *pObj);
 
 static int tohil_mod_exec(PyObject *m);
 
@@ -148,6 +282,272 @@ tohil_TclObjIsNoneSentinel(Tcl_Obj *obj, const char *sentinel)
     return (STREQU(tclString, sentinel));
 }
 
+//
+// string transcoding
+//
+// tcl keeps strings in a modified utf-8, "WTF-8", where NUL is the two
+// bytes C0 80 and characters outside the basic multilingual plane are
+// surrogate pairs encoded separately, each starting with ED.  python
+// wants real utf-8.  but most strings are plain ASCII, or ordinary utf-8
+// with none of that, which is the same in both, so we look at the bytes
+// first and only go through tcl's encoding machinery when we have to.
+//
+// the scans go a 64-bit word at a time, and only look at individual
+// bytes in words that have a byte with the high bit set.
+//
+#define TOHIL_ONES 0x0101010101010101ULL
+#define TOHIL_HIGHS 0x8080808080808080ULL
+#define TOHIL_HAS_ZERO_BYTE(v) (((v)-TOHIL_ONES) & ~(v)&TOHIL_HIGHS)
+
+//
+// tohil_utf8_encoding - tcl's utf-8 encoding, for the slow paths
+//
+static Tcl_Encoding
+tohil_utf8_encoding(Tcl_Interp *interp)
+{
+    static Tcl_Encoding utf8encoding = NULL;
+    if (!utf8encoding)
+        utf8encoding = Tcl_GetEncoding(interp, "utf-8");
+    return utf8encoding;
+}
+
+//
+// tohil_tcl_byte_needs_transcoding - true if a byte of a tcl string
+//   could start something that's different in real utf-8: C0 (NUL),
+//   ED (surrogates), or C1 and F0 and up, which are never valid in
+//   what we can pass straight through
+//
+static inline int
+tohil_tcl_byte_needs_transcoding(unsigned char c)
+{
+    return (c & 0xFE) == 0xC0 || c == 0xED || c >= 0xF0;
+}
+
+//
+// tohil_tcl_string_needs_transcoding - true if a tcl string can't
+//   be handed to python as utf-8 just as it is
+//
+static int
+tohil_tcl_string_needs_transcoding(const char *s, Py_ssize_t len)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    Py_ssize_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        uint64_t v;
+        memcpy(&v, p + i, 8);
+        if ((v & TOHIL_HIGHS) == 0)
+            continue;
+        for (int j = 0; j < 8; j++) {
+            if (tohil_tcl_byte_needs_transcoding(p[i + j]))
+                return 1;
+        }
+    }
+    for (; i < len; i++) {
+        if (tohil_tcl_byte_needs_transcoding(p[i]))
+            return 1;
+    }
+    return 0;
+}
+
+//
+// tohil_utf8_string_needs_transcoding - true if a utf-8 string from python
+//   can't be handed to tcl just as it is, because it contains NULs or
+//   characters outside the basic multilingual plane (4-byte sequences)
+//
+static int
+tohil_utf8_string_needs_transcoding(const char *s, Py_ssize_t len)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    Py_ssize_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        uint64_t v;
+        memcpy(&v, p + i, 8);
+        if (TOHIL_HAS_ZERO_BYTE(v))
+            return 1;
+        if ((v & TOHIL_HIGHS) == 0)
+            continue;
+        // a byte is F0 or above if its high nibble, xored with F, is zero
+        uint64_t hi = (v & 0xF0F0F0F0F0F0F0F0ULL) ^ 0xF0F0F0F0F0F0F0F0ULL;
+        if (TOHIL_HAS_ZERO_BYTE(hi))
+            return 1;
+    }
+    for (; i < len; i++) {
+        if (p[i] == 0 || p[i] >= 0xF0)
+            return 1;
+    }
+    return 0;
+}
+
+//
+// tohil_TclStringToPyUnicode - make a python string from a tcl string
+//
+static PyObject *
+tohil_TclStringToPyUnicode(Tcl_Interp *interp, const char *tclString, int tclStringLen)
+{
+    if (!tohil_tcl_string_needs_transcoding(tclString, tclStringLen)) {
+        PyObject *pObj = PyUnicode_DecodeUTF8(tclString, tclStringLen, NULL);
+        // it was ascii or good utf-8 unless tcl has been handed
+        // some bad bytes, in which case let tcl sort them out
+        if (pObj != NULL || !PyErr_ExceptionMatches(PyExc_UnicodeDecodeError))
+            return pObj;
+        PyErr_Clear();
+    }
+
+    Tcl_DString ds;
+    char *utf8String = Tcl_UtfToExternalDString(tohil_utf8_encoding(interp), tclString, tclStringLen, &ds);
+    PyObject *pObj = PyUnicode_FromStringAndSize(utf8String, Tcl_DStringLength(&ds));
+    Tcl_DStringFree(&ds);
+    return pObj;
+}
+
+//
+// tohil.pystr tcl object type
+//
+// a tcl object whose string came from, or has been turned into, a
+// python str remembers that str as its internal rep, along with the
+// python interpreter it belongs to.  converting the object back to
+// a str, in that interpreter, hands back the very same str without
+// looking at the bytes again.
+//
+// tcl always frees an object's internal rep before it changes the
+// object's string, so if the object still has this type, the str is
+// still good.  tohil never releases the GIL, so tcl holds it
+// whenever it frees or duplicates one of these.
+//
+static void tohil_pystr_free_internal_rep(Tcl_Obj *obj);
+static void tohil_pystr_dup_internal_rep(Tcl_Obj *srcObj, Tcl_Obj *dupObj);
+static void tohil_pystr_update_string(Tcl_Obj *obj);
+
+static const Tcl_ObjType tohilPyStrType = {
+    "tohil.pystr",
+    tohil_pystr_free_internal_rep,
+    tohil_pystr_dup_internal_rep,
+    tohil_pystr_update_string,
+    NULL,
+};
+
+#define TOHIL_PYSTR(obj) ((PyObject *)(obj)->internalRep.twoPtrValue.ptr1)
+#define TOHIL_PYSTR_INTERP(obj) ((PyInterpreterState *)(obj)->internalRep.twoPtrValue.ptr2)
+
+static void
+tohil_pystr_free_internal_rep(Tcl_Obj *obj)
+{
+    // if python has gone away, so has the str
+    if (Py_IsInitialized())
+        Py_DECREF(TOHIL_PYSTR(obj));
+    obj->typePtr = NULL;
+}
+
+static void
+tohil_pystr_dup_internal_rep(Tcl_Obj *srcObj, Tcl_Obj *dupObj)
+{
+    Py_INCREF(TOHIL_PYSTR(srcObj));
+    dupObj->internalRep.twoPtrValue.ptr1 = TOHIL_PYSTR(srcObj);
+    dupObj->internalRep.twoPtrValue.ptr2 = TOHIL_PYSTR_INTERP(srcObj);
+    dupObj->typePtr = &tohilPyStrType;
+}
+
+//
+// tohil_pystr_update_string - regenerate the string rep from the str.
+//   the string rep is set along with the internal rep, and tcl frees
+//   the internal rep before invalidating it, so this shouldn't be
+//   needed, but tcl requires it if anything ever does.
+//
+static void
+tohil_pystr_update_string(Tcl_Obj *obj)
+{
+    Py_ssize_t utf8len;
+    const char *utf8 = PyUnicode_AsUTF8AndSize(TOHIL_PYSTR(obj), &utf8len);
+    assert(utf8 != NULL);
+
+    Tcl_DString ds;
+    char *tclString = Tcl_ExternalToUtfDString(tohil_utf8_encoding(NULL), utf8, utf8len, &ds);
+    int tclStringLen = Tcl_DStringLength(&ds);
+    obj->bytes = ckalloc(tclStringLen + 1);
+    memcpy(obj->bytes, tclString, tclStringLen + 1);
+    obj->length = tclStringLen;
+    Tcl_DStringFree(&ds);
+}
+
+//
+// tohil_pystr_attach - make an object with no internal rep remember
+//   the str its string rep is equal to
+//
+static void
+tohil_pystr_attach(Tcl_Obj *obj, PyObject *pStr)
+{
+    assert(obj->typePtr == NULL);
+    Py_INCREF(pStr);
+    obj->internalRep.twoPtrValue.ptr1 = pStr;
+    obj->internalRep.twoPtrValue.ptr2 = PyInterpreterState_Get();
+    obj->typePtr = &tohilPyStrType;
+}
+
+//
+// tohil_TclObjToPyUnicodeAsIs - make a python string from a tcl object's
+//   string rep, using the str it remembers if it has one, but leaving
+//   the object as it was
+//
+static PyObject *
+tohil_TclObjToPyUnicodeAsIs(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    if (obj->typePtr == &tohilPyStrType && TOHIL_PYSTR_INTERP(obj) == PyInterpreterState_Get()) {
+        Py_INCREF(TOHIL_PYSTR(obj));
+        return TOHIL_PYSTR(obj);
+    }
+
+    int tclStringLen;
+    const char *tclString = Tcl_GetStringFromObj(obj, &tclStringLen);
+    return tohil_TclStringToPyUnicode(interp, tclString, tclStringLen);
+}
+
+//
+// tohil_TclObjToPyUnicode - make a python string from a tcl object's string rep
+//
+static PyObject *
+tohil_TclObjToPyUnicode(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    PyObject *pStr = tohil_TclObjToPyUnicodeAsIs(interp, obj);
+
+    // a pure string has no internal rep to lose by remembering the str.
+    // a long one isn't worth keeping a second copy of around for as
+    // long as tcl holds on to it.
+    if (pStr != NULL && obj->typePtr == NULL && obj->length <= TOHIL_PYSTR_MAX_LENGTH)
+        tohil_pystr_attach(obj, pStr);
+    return pStr;
+}
+
+//
+// tohil_PyUnicodeToTclObj - make a new tcl object from a python str.
+//   returns NULL with a python exception set if the string can't be
+//   had as utf-8, i.e. it contains lone surrogates.
+//
+static Tcl_Obj *
+tohil_PyUnicodeToTclObj(Tcl_Interp *interp, PyObject *pStr)
+{
+    Py_ssize_t utf8len;
+    const char *utf8 = PyUnicode_AsUTF8AndSize(pStr, &utf8len);
+    if (utf8 == NULL)
+        return NULL;
+
+    Tcl_Obj *obj;
+    if (!tohil_utf8_string_needs_transcoding(utf8, utf8len)) {
+        obj = Tcl_NewStringObj(utf8, utf8len);
+    } else {
+        Tcl_DString ds;
+        char *tclString = Tcl_ExternalToUtfDString(tohil_utf8_encoding(interp), utf8, utf8len, &ds);
+        obj = Tcl_NewStringObj(tclString, Tcl_DStringLength(&ds));
+        Tcl_DStringFree(&ds);
+    }
+
+    // str subclasses have to come back as plain strs
+    if (PyUnicode_CheckExact(pStr))
+        tohil_pystr_attach(obj, pStr);
+    return obj;
+}
+
 //
 // tohil_TclObjToUTF8DString - convert a Tcl object (string in WTF-8) to real UTF-8
 // for Python. Use a DString for buffering.
@@ -155,12 +555,13 @@ tohil_TclObjIsNoneSentinel(Tcl_Obj *obj, const char *sentinel)
 static char *
 tohil_TclObjToUTF8DString(Tcl_Interp *interp, Tcl_Obj *obj, Tcl_DString *ds)
 {
-    static Tcl_Encoding utf8encoding = NULL;
-    if (!utf8encoding)
-        utf8encoding = Tcl_GetEncoding(interp, "utf-8");
     int tclStringLen;
     char *tclString = Tcl_GetStringFromObj(obj, &tclStringLen);
-    return Tcl_UtfToExternalDString(utf8encoding, tclString, tclStringLen, ds);
+    if (!tohil_tcl_string_needs_transcoding(tclString, tclStringLen)) {
+        Tcl_DStringInit(ds);
+        return Tcl_DStringAppend(ds, tclString, tclStringLen);
+    }
+    return Tcl_UtfToExternalDString(tohil_utf8_encoding(interp), tclString, tclStringLen, ds);
 }
 
 //
@@ -170,14 +571,15 @@ tohil_TclObjToUTF8DString(Tcl_Interp *interp, Tcl_Obj *obj, Tcl_DString *ds)
 static char *
 tohil_UTF8ToTclDString(Tcl_Interp *interp, char *utf8String, int utf8StringLen, Tcl_DString *ds)
 {
-    static Tcl_Encoding utf8encoding = NULL;
-    if (!utf8encoding)
-        utf8encoding = Tcl_GetEncoding(interp, "utf-8");
     // Accepts -1 for string length but try to avoid it.
     if (utf8StringLen == -1) {
         utf8StringLen = strlen(utf8String);
     }
-    return Tcl_ExternalToUtfDString(utf8encoding, utf8String, utf8StringLen, ds);
+    if (!tohil_utf8_string_needs_transcoding(utf8String, utf8StringLen)) {
+        Tcl_DStringInit(ds);
+        return Tcl_DStringAppend(ds, utf8String, utf8StringLen);
+    }
+    return Tcl_ExternalToUtfDString(tohil_utf8_encoding(interp), utf8String, utf8StringLen, ds);
 }
 
 //
@@ -272,11 +674,16 @@ tclListObjToPyListObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     }
 
     PyObject *plist = PyList_New(count);
+    if (plist == NULL)
+        return NULL;
 
     for (int i = 0; i < count; i++) {
-        Tcl_DString ds;
-        PyList_SET_ITEM(plist, i, Py_BuildValue("s", tohil_TclObjToUTF8DString(interp, list[i], &ds)));
-        Tcl_DStringFree(&ds);
+        PyObject *pElement = tohil_TclObjToPyUnicode(interp, list[i]);
+        if (pElement == NULL) {
+            Py_DECREF(plist);
+            return NULL;
+        }
+        PyList_SET_ITEM(plist, i, pElement);
     }
 
     return plist;
@@ -297,14 +704,18 @@ tclListObjToPySetObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     }
 
     PyObject *pset = PySet_New(NULL);
+    if (pset == NULL)
+        return NULL;
 
     for (int i = 0; i < count; i++) {
-        Tcl_DString ds;
-        if (PySet_Add(pset, Py_BuildValue("s", tohil_TclObjToUTF8DString(interp, list[i], &ds))) < 0) {
-            // no need to set a python error; PySet_Add will do it
+        PyObject *pElement = tohil_TclObjToPyUnicode(interp, list[i]);
+        // no need to set a python error; PySet_Add will do it
+        if (pElement == NULL || PySet_Add(pset, pElement) < 0) {
+            Py_XDECREF(pElement);
+            Py_DECREF(pset);
             return NULL;
         }
-        Tcl_DStringFree(&ds);
+        Py_DECREF(pElement);
     }
 
     return pset;
@@ -325,16 +736,44 @@ tclListObjToPyTupleObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     }
 
     PyObject *ptuple = PyTuple_New(count);
+    if (ptuple == NULL)
+        return NULL;
 
     for (int i = 0; i < count; i++) {
-        Tcl_DString ds;
-        PyTuple_SET_ITEM(ptuple, i, Py_BuildValue("s", tohil_TclObjToUTF8DString(interp, list[i], &ds)));
-        Tcl_DStringFree(&ds);
+        PyObject *pElement = tohil_TclObjToPyUnicode(interp, list[i]);
+        if (pElement == NULL) {
+            Py_DECREF(ptuple);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(ptuple, i, pElement);
     }
 
     return ptuple;
 }
 
+//
+// tohil_dict_set_converted - set key to value in a python dict, where
+//   the key is a tcl object converted to an interned python str and the value
+//   is a new reference, which is consumed.  returns -1 on failure.
+//
+static int
+tohil_dict_set_converted(Tcl_Interp *interp, PyObject *pdict, Tcl_Obj *keyObj, PyObject *pValue)
+{
+    if (pValue == NULL)
+        return -1;
+
+    PyObject *pKey = tohil_TclObjToPyKey(interp, keyObj);
+    if (pKey == NULL) {
+        Py_DECREF(pValue);
+        return -1;
+    }
+
+    int result = PyDict_SetItem(pdict, pKey, pValue);
+    Py_DECREF(pKey);
+    Py_DECREF(pValue);
+    return result;
+}
+
 //
 // turn a tcl list of key-value pairs into a python dict
 //
@@ -356,14 +795,14 @@ tclListObjToPyDictObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     }
 
     PyObject *pdict = PyDict_New();
+    if (pdict == NULL)
+        return NULL;
 
     for (int i = 0; i < count; i += 2) {
-        Tcl_DString kds, vds;
-        char *key = tohil_TclObjToUTF8DString(interp, list[i], &kds);
-        char *val = tohil_TclObjToUTF8DString(interp, list[i + 1], &vds);
-        PyDict_SetItem(pdict, Py_BuildValue("s", key), Py_BuildValue("s", val));
-        Tcl_DStringFree(&kds);
-        Tcl_DStringFree(&vds);
+        if (tohil_dict_set_converted(interp, pdict, list[i], tohil_TclObjToPyUnicode(interp, list[i + 1])) < 0) {
+            Py_DECREF(pdict);
+            return NULL;
+        }
     }
 
     return pdict;
@@ -391,79 +830,17 @@ tclListObjToPyDictTclObjects(Tcl_Interp *interp, Tcl_Obj *inputObj)
     }
 
     PyObject *pdict = PyDict_New();
+    if (pdict == NULL)
+        return NULL;
 
     for (int i = 0; i < count; i += 2) {
-        Tcl_DString kds;
-        char *key = tohil_TclObjToUTF8DString(interp, list[i], &kds);
-        PyDict_SetItem(pdict, Py_BuildValue("s", key), TohilTclObj_FromTclObj(interp, list[i + 1]));
-        Tcl_DStringFree(&kds);
-    }
-
-    return pdict;
-}
-
-//
-// Convert a Python UTF8 string to a Tcl "WTF-8" string.
-//
-static int
-tohil_UTF8ToTcl(Tcl_Interp *interp, char *src, int srclen, char **res, int *reslen)
-{
-    static Tcl_Encoding utf8encoding = NULL;
-    int buflen = srclen;
-    char *buf = ckalloc(buflen + 4);
-    int written;
-    int result;
-    if (!utf8encoding)
-        utf8encoding = Tcl_GetEncoding(interp, "utf-8");
-
-    while (1) {
-        result = Tcl_ExternalToUtf(interp, utf8encoding, src, srclen, 0, NULL, buf, buflen + 4, NULL, &written, NULL);
-        if (result == TCL_OK) {
-            *res = buf;
-            *reslen = written;
-            return TCL_OK;
-        }
-        if (result == TCL_CONVERT_NOSPACE) {
-            ckfree(buf);
-            buflen *= 2;
-            buf = ckalloc(buflen + 4);
-            continue;
+        if (tohil_dict_set_converted(interp, pdict, list[i], TohilTclObj_FromTclObj(interp, list[i + 1])) < 0) {
+            Py_DECREF(pdict);
+            return NULL;
         }
-        ckfree(buf);
-        return result;
     }
-}
 
-//
-// Convert a Tcl "WTF-8" string to a Python UTF8 string
-//
-static int
-tohil_TclToUTF8(Tcl_Interp *interp, char *src, int srclen, char **res, int *reslen)
-{
-    static Tcl_Encoding utf8encoding = NULL;
-    int buflen = srclen;
-    char *buf = ckalloc(buflen + 4);
-    int written;
-    if (!utf8encoding)
-        utf8encoding = Tcl_GetEncoding(interp, "utf-8");
-    int result;
-
-    while (1) {
-        result = Tcl_UtfToExternal(interp, utf8encoding, src, srclen, 0, NULL, buf, buflen + 4, NULL, &written, NULL);
-        if (result == TCL_OK) {
-            *res = buf;
-            *reslen = written;
-            return TCL_OK;
-        }
-        if (result == TCL_CONVERT_NOSPACE) {
-            ckfree(buf);
-            buflen *= 2;
-            buf = ckalloc(buflen + 4);
-            continue;
-        }
-        ckfree(buf);
-        return result;
-    }
+    return pdict;
 }
 
 #ifdef UNUSED
@@ -497,233 +874,1235 @@ tclObjToPy(Tcl_Interp *interp, Tcl_Obj *tObj)
         return PyFloat_FromDouble(doubleValue);
     }
 
-    int tclStringSize;
-    char *tclString;
-    tclString = Tcl_GetStringFromObj(tObj, &tclStringSize);
-
-    int utf8len;
-    char *utf8string;
-    if (tohil_TclToUTF8(interp, tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
-        return NULL;
-    }
-    PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-    ckfree(utf8string);
-    return pObj;
+    return tohil_TclObjToPyUnicode(interp, tObj);
 }
 #endif
 
+// tcl object types we know how to turn into something other than a string,
+// found once by tohil_find_tcl_types
+static const Tcl_ObjType *tclIntType = NULL;
+static const Tcl_ObjType *tclWideIntType = NULL;
+static const Tcl_ObjType *tclBignumType = NULL;
+static const Tcl_ObjType *tclDoubleType = NULL;
+static const Tcl_ObjType *tclBooleanType = NULL;
+static const Tcl_ObjType *tclListType = NULL;
+static const Tcl_ObjType *tclDictType = NULL;
+static const Tcl_ObjType *tclByteArrayType = NULL;
+
 //
-// convert a python object to a tcl object - amazing code by aidan
+// tohil_find_tcl_types - look up tcl's object types.  not all of them
+//   are registered by name, so for some we make an object and look at it.
 //
-static Tcl_Obj *
-_pyObjToTcl(Tcl_Interp *interp, PyObject *pObj)
+static void
+tohil_find_tcl_types(void)
 {
-    Tcl_Obj *tObj;
-    PyObject *pBytesObj;
-    PyObject *pStrObj;
+    Tcl_Obj *obj;
 
-    Py_ssize_t i, len;
-    PyObject *pVal = NULL;
-    Tcl_Obj *tVal;
-
-    PyObject *pItems = NULL;
-    PyObject *pItem = NULL;
-    PyObject *pKey = NULL;
-    Tcl_Obj *tKey;
-
-    char *utf8string;
-    int utf8len;
-
-    /*
-     * The ordering must always be more 'specific' types first. E.g. a
-     * string also obeys the sequence protocol...but we probably want it
-     * to be a string rather than a list. Suggested order below:
-     * - None -> {}
-     * - True -> 1, False -> 0
-     * - tclobj -> tclobj
-     * - tcldict -> tcldict
-     * - bytes -> tcl byte string
-     * - unicode -> tcl unicode string
-     * - number protocol -> tcl number
-     * - sequence protocol -> tcl list
-     * - mapping protocol -> tcl dict
-     * - other -> error (currently converts to string)
-     *
-     * Note that the sequence and mapping protocol are both determined by __getitem__,
-     * the only difference is that dict subclasses are excluded from sequence.
-     */
+    if (tclListType != NULL)
+        return;
 
-    if (pObj == Py_None) {
-        tObj = Tcl_NewObj();
-    } else if (pObj == Py_True || pObj == Py_False) {
-        tObj = Tcl_NewBooleanObj(pObj == Py_True);
-    } else if (TohilTclObj_Check(pObj) || TohilTclDict_Check(pObj)) {
-        TohilTclObj *pyTclObj = (TohilTclObj *)pObj;
-        tObj = TohilTclObj_objptr(pyTclObj);
-    } else if (PyBytes_Check(pObj)) {
-        tObj = Tcl_NewByteArrayObj((const unsigned char *)PyBytes_AS_STRING(pObj), PyBytes_GET_SIZE(pObj));
-    } else if (PyUnicode_Check(pObj)) {
-        pBytesObj = PyUnicode_AsUTF8String(pObj);
-        if (pBytesObj == NULL)
-            return NULL;
-        if (tohil_UTF8ToTcl(interp, PyBytes_AS_STRING(pBytesObj), PyBytes_GET_SIZE(pBytesObj), &utf8string, &utf8len) != TCL_OK) {
-            Py_DECREF(pBytesObj);
-            return NULL;
-        }
-        tObj = Tcl_NewStringObj(utf8string, utf8len);
-        ckfree(utf8string);
-        Py_DECREF(pBytesObj);
-    } else if (PyNumber_Check(pObj)) {
-        // we go via string to support arbitrary length numbers
-        if (PyLong_Check(pObj)) {
-            int overflow = 0;
-            // try long conversion
-            long longValue = PyLong_AsLongAndOverflow(pObj, &overflow);
-            if (!overflow)
-                return Tcl_NewLongObj(longValue);
-
-            // not big enough try long long conversion
-            overflow = 0;
-            Tcl_WideInt wideValue = PyLong_AsLongLongAndOverflow(pObj, &overflow);
-            if (!overflow) {
-                return Tcl_NewWideIntObj(wideValue);
-            }
-            // still not big enough just use strings
-            // (both python and tcl have bignum support)
-            pStrObj = PyNumber_ToBase(pObj, 10);
-        } else {
-            // it's not int, it better be float or complex
-            if (PyFloat_Check(pObj)) {
-                // it's float, effeciently get it from python
-                // to tcl
-                double doubleValue = PyFloat_AsDouble(pObj);
-                if (doubleValue == 1.0 && PyErr_Occurred()) {
-                    return NULL;
-                }
-                return Tcl_NewDoubleObj(doubleValue);
-            }
-            // it has to be complex type at this point, punt to string
-            assert(PyComplex_Check(pObj));
-            pStrObj = PyObject_Str(pObj);
-        }
+    obj = Tcl_NewIntObj(0);
+    tclIntType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
 
-        // still here?  it's either wider than a long long, or
-        // complex, send it to tcl as a string
-        if (pStrObj == NULL)
-            return NULL;
-        pBytesObj = PyUnicode_AsUTF8String(pStrObj);
-        Py_DECREF(pStrObj);
-        if (pBytesObj == NULL)
-            return NULL;
-        if (tohil_UTF8ToTcl(interp, PyBytes_AS_STRING(pBytesObj), PyBytes_GET_SIZE(pBytesObj), &utf8string, &utf8len) != TCL_OK) {
-            Py_DECREF(pBytesObj);
-            return NULL;
-        }
-        tObj = Tcl_NewStringObj(utf8string, utf8len);
-        ckfree(utf8string);
-        Py_DECREF(pBytesObj);
-    } else if (PySequence_Check(pObj)) {
-        tObj = Tcl_NewListObj(0, NULL);
-        len = PySequence_Length(pObj);
-        if (len == -1)
-            return NULL;
+    obj = Tcl_NewWideIntObj(0);
+    tclWideIntType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
 
-        for (i = 0; i < len; i++) {
-            pVal = PySequence_GetItem(pObj, i);
-            if (pVal == NULL)
-                return NULL;
-            tVal = _pyObjToTcl(interp, pVal);
-            Py_DECREF(pVal);
-            if (tVal == NULL)
-                return NULL;
-            Tcl_ListObjAppendElement(interp, tObj, tVal);
-        }
-    } else if (PySet_Check(pObj)) {
-        // NB heavily cribbed from the above
-        // might be useful for other stuff besides sets, if it works
-        PyObject *it = PyObject_GetIter(pObj);
-        if (it == NULL)
-            return NULL;
-        tObj = Tcl_NewListObj(0, NULL);
-        while ((pVal = PyIter_Next(it)) != NULL) {
-            if (pVal == NULL)
-                return NULL;
-            tVal = _pyObjToTcl(interp, pVal);
-            Py_DECREF(pVal);
-            if (tVal == NULL)
-                return NULL;
-            Tcl_ListObjAppendElement(interp, tObj, tVal);
-        }
-    } else if (PyMapping_Check(pObj)) {
-        tObj = Tcl_NewDictObj();
-        len = PyMapping_Length(pObj);
-        if (len == -1)
-            return NULL;
-        pItems = PyMapping_Items(pObj);
-        if (pItems == NULL)
-            return NULL;
-#define ONERR(VAR)         \
-    if (VAR == NULL) {     \
-        Py_DECREF(pItems); \
-        return NULL;       \
-    }
-        for (i = 0; i < len; i++) {
-            pItem = PySequence_GetItem(pItems, i);
-            ONERR(pItem)
-            pKey = PySequence_GetItem(pItem, 0);
-            ONERR(pKey)
-            pVal = PySequence_GetItem(pItem, 1);
-            ONERR(pVal)
-            tKey = _pyObjToTcl(interp, pKey);
-            Py_DECREF(pKey);
-            ONERR(tKey);
-            tVal = _pyObjToTcl(interp, pVal);
-            Py_DECREF(pVal);
-            ONERR(tVal);
-            Tcl_DictObjPut(interp, tObj, tKey, tVal);
-        }
-#undef ONERR
-        Py_DECREF(pItems);
-        /* Broke out of loop because of error */
-        if (i != len) {
-            Py_XDECREF(pItem);
-            return NULL;
-        }
-    } else {
-        /* Get python string representation of other objects */
-        pStrObj = PyObject_Str(pObj);
-        if (pStrObj == NULL)
-            return NULL;
-        pBytesObj = PyUnicode_AsUTF8String(pStrObj);
-        Py_DECREF(pStrObj);
-        if (pBytesObj == NULL)
-            return NULL;
-        if (tohil_UTF8ToTcl(interp, PyBytes_AS_STRING(pBytesObj), PyBytes_GET_SIZE(pBytesObj), &utf8string, &utf8len) != TCL_OK) {
-            Py_DECREF(pBytesObj);
-            return NULL;
-        }
-        tObj = Tcl_NewStringObj(utf8string, utf8len);
-        ckfree(utf8string);
-        Py_DECREF(pBytesObj);
-    }
+    obj = Tcl_NewDoubleObj(0.0);
+    tclDoubleType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
 
-    return tObj;
+    obj = Tcl_NewDictObj();
+    tclDictType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
+
+    obj = Tcl_NewByteArrayObj(NULL, 0);
+    tclByteArrayType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
+
+    // parsing an integer too big for a wide int leaves it a bignum
+    Tcl_WideInt wideValue;
+    obj = Tcl_NewStringObj("0x10000000000000000", -1);
+    Tcl_GetWideIntFromObj(NULL, obj, &wideValue);
+    tclBignumType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
+
+    // a string parsed as a boolean that isn't a number is a booleanString
+    int boolValue;
+    obj = Tcl_NewStringObj("true", -1);
+    Tcl_GetBooleanFromObj(NULL, obj, &boolValue);
+    tclBooleanType = obj->typePtr;
+    Tcl_DecrRefCount(obj);
+
+    tclListType = Tcl_GetObjType("list");
 }
 
+//
+// bignums
+//
+// python ints too big for a wide int and tcl bignums cross over as
+// little-endian bytes of their magnitude, which python reads and writes
+// directly, repacked to and from tommath's MP_DIGIT_BIT-bit digits,
+// rather than being formatted as decimal and parsed again.
+//
+
+// the packing below accumulates a digit plus a byte in 64 bits
+#if MP_DIGIT_BIT > 56
+#error "tohil's bignum conversion needs tommath digits of 56 bits or less"
+#endif
+
+// bignums up to this many bytes are converted without allocating
+#define TOHIL_STATIC_BIGNUM_BYTES 64
+
+//
+// tohil_mp_to_PyLong - make a python int from a tommath integer
+//
+static PyObject *
+tohil_mp_to_PyLong(const mp_int *big)
+{
+    unsigned char staticBytes[TOHIL_STATIC_BIGNUM_BYTES];
+    size_t nbytes = ((size_t)big->used * MP_DIGIT_BIT + 7) / 8;
+    unsigned char *bytes = staticBytes;
+
+    if (nbytes > TOHIL_STATIC_BIGNUM_BYTES) {
+        bytes = PyMem_Malloc(nbytes);
+        if (bytes == NULL)
+            return PyErr_NoMemory();
+    }
+
+    uint64_t acc = 0;
+    int accBits = 0;
+    size_t n = 0;
+    for (int i = 0; i < big->used; i++) {
+        acc |= (uint64_t)big->dp[i] << accBits;
+        accBits += MP_DIGIT_BIT;
+        while (accBits >= 8) {
+            bytes[n++] = acc & 0xFF;
+            acc >>= 8;
+            accBits -= 8;
+        }
+    }
+    if (accBits > 0)
+        bytes[n++] = acc & 0xFF;
+    assert(n <= nbytes);
+
+    PyObject *pLong = _PyLong_FromByteArray(bytes, n, 1, 0);
+    if (bytes != staticBytes)
+        PyMem_Free(bytes);
+
+    if (pLong != NULL && big->sign == MP_NEG) {
+        PyObject *pNeg = PyNumber_Negative(pLong);
+        Py_DECREF(pLong);
+        pLong = pNeg;
+    }
+    return pLong;
+}
+
+//
+// tohil_PyLong_to_TclBignum - make a new tcl bignum object from a python int
+//
+static Tcl_Obj *
+tohil_PyLong_to_TclBignum(PyObject *pLong)
+{
+    size_t nbits = _PyLong_NumBits(pLong);
+    if (nbits == (size_t)-1 && PyErr_Occurred())
+        return NULL;
+
+    // one more byte than the magnitude needs, for the sign
+    unsigned char staticBytes[TOHIL_STATIC_BIGNUM_BYTES];
+    size_t nbytes = nbits / 8 + 1;
+    unsigned char *bytes = staticBytes;
+
+    if (nbytes > TOHIL_STATIC_BIGNUM_BYTES) {
+        bytes = PyMem_Malloc(nbytes);
+        if (bytes == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+
+    Tcl_Obj *tObj = NULL;
+    if (tohil_PyLong_AsByteArray(pLong, bytes, nbytes, 1, 1) < 0)
+        goto done;
+
+    // take the magnitude of a negative two's complement number
+    int negative = (bytes[nbytes - 1] & 0x80) != 0;
+    if (negative) {
+        unsigned int carry = 1;
+        for (size_t i = 0; i < nbytes; i++) {
+            unsigned int b = (unsigned char)~bytes[i] + carry;
+            bytes[i] = b & 0xFF;
+            carry = b >> 8;
+        }
+    }
+
+    mp_int big;
+    if (mp_init_size(&big, (int)((nbytes * 8 + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT)) != MP_OKAY) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    uint64_t acc = 0;
+    int accBits = 0;
+    int used = 0;
+    for (size_t i = 0; i < nbytes; i++) {
+        acc |= (uint64_t)bytes[i] << accBits;
+        accBits += 8;
+        if (accBits >= MP_DIGIT_BIT) {
+            big.dp[used++] = (mp_digit)(acc & MP_MASK);
+            acc >>= MP_DIGIT_BIT;
+            accBits -= MP_DIGIT_BIT;
+        }
+    }
+    if (accBits > 0)
+        big.dp[used++] = (mp_digit)(acc & MP_MASK);
+    big.used = used;
+    big.sign = negative ? MP_NEG : MP_ZPOS;
+    mp_clamp(&big);
+
+    // tcl takes over the digits
+    tObj = Tcl_NewBignumObj(&big);
+
+done:
+    if (bytes != staticBytes)
+        PyMem_Free(bytes);
+    return tObj;
+}
+
+//
+// tohil_TclObjToPyLong - get a python int from a tcl object holding an
+//   integer of any size.  returns TCL_ERROR, with the error in the
+//   interpreter result if interp isn't NULL, if the object isn't an
+//   integer.  otherwise returns TCL_OK, with *pLongPtr set to the new
+//   int, or to NULL with a python exception set if making it failed.
+//
+static int
+tohil_TclObjToPyLong(Tcl_Interp *interp, Tcl_Obj *obj, PyObject **pLongPtr)
+{
+    tohil_find_tcl_types();
+
+    // tcl will give a bignum of up to 64 bits as a wide int, wrapped
+    // around, so after parsing make sure it didn't turn out to be one
+    Tcl_WideInt wideValue;
+    if (Tcl_GetWideIntFromObj(NULL, obj, &wideValue) == TCL_OK && obj->typePtr != tclBignumType) {
+        *pLongPtr = PyLong_FromLongLong(wideValue);
+        return TCL_OK;
+    }
+
+    mp_int big;
+    if (Tcl_GetBignumFromObj(interp, obj, &big) != TCL_OK)
+        return TCL_ERROR;
+
+    *pLongPtr = tohil_mp_to_PyLong(&big);
+    mp_clear(&big);
+    return TCL_OK;
+}
+
+static PyObject *tclObjToPyTyped(Tcl_Interp *interp, Tcl_Obj *obj);
+
+//
+// tclObjToPyTypedNested - convert an element or value of a tcl list or
+//   dict with tclObjToPyTyped.  tcl values can nest deeper than the C
+//   stack can recurse, so past python's recursion limit this raises
+//   RecursionError rather than crashing.
+//
+static PyObject *
+tclObjToPyTypedNested(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    if (Py_EnterRecursiveCall(" while converting a tcl object to python"))
+        return NULL;
+    PyObject *pObj = tclObjToPyTyped(interp, obj);
+    Py_LeaveRecursiveCall();
+    return pObj;
+}
+
+//
+// tclObjToPyTyped - turn a tcl object into a python object according to
+//   what tcl already knows it to be, i.e. by looking at its internal
+//   representation.  integers become python ints, doubles floats,
+//   booleans bools, byte arrays bytes, lists lists and dicts dicts,
+//   with their elements and values converted the same way.  dict keys
+//   are always strings.  anything else becomes a string.
+//
+//   nothing is parsed to find out what it might be, so tcl objects
+//   don't get their internal representations changed, and a string
+//   that merely looks like a number stays a string.
+//
+static PyObject *
+tclObjToPyTyped(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    const Tcl_ObjType *typePtr = obj->typePtr;
+
+    if (typePtr == NULL)
+        return tohil_TclObjToPyUnicodeAsIs(interp, obj);
+
+    tohil_find_tcl_types();
+
+    if (typePtr == tclIntType || typePtr == tclWideIntType || typePtr == tclBignumType) {
+        PyObject *pLong;
+        if (tohil_TclObjToPyLong(NULL, obj, &pLong) == TCL_OK)
+            return pLong;
+    } else if (typePtr == tclDoubleType) {
+        double doubleValue;
+        if (Tcl_GetDoubleFromObj(NULL, obj, &doubleValue) == TCL_OK)
+            return PyFloat_FromDouble(doubleValue);
+    } else if (typePtr == tclBooleanType) {
+        int intValue;
+        if (Tcl_GetBooleanFromObj(NULL, obj, &intValue) == TCL_OK)
+            return PyBool_FromLong(intValue);
+    } else if (typePtr == tclByteArrayType) {
+        int size;
+        unsigned char *bytes = Tcl_GetByteArrayFromObj(obj, &size);
+        return PyBytes_FromStringAndSize((const char *)bytes, size);
+    } else if (typePtr == tclListType) {
+        Tcl_Obj **list;
+        int count;
+
+        if (Tcl_ListObjGetElements(NULL, obj, &count, &list) == TCL_OK) {
+            PyObject *plist = PyList_New(count);
+            if (plist == NULL)
+                return NULL;
+            for (int i = 0; i < count; i++) {
+                PyObject *element = tclObjToPyTypedNested(interp, list[i]);
+                if (element == NULL) {
+                    Py_DECREF(plist);
+                    return NULL;
+                }
+                PyList_SET_ITEM(plist, i, element);
+            }
+            return plist;
+        }
+    } else if (typePtr == tclDictType) {
+        Tcl_DictSearch search;
+        Tcl_Obj *key, *value;
+        int done;
+
+        if (Tcl_DictObjFirst(NULL, obj, &search, &key, &value, &done) == TCL_OK) {
+            PyObject *pdict = PyDict_New();
+            if (pdict == NULL) {
+                Tcl_DictObjDone(&search);
+                return NULL;
+            }
+            for (; !done; Tcl_DictObjNext(&search, &key, &value, &done)) {
+                PyObject *pKey = tohil_TclObjToPyKey(interp, key);
+                PyObject *pValue = (pKey == NULL) ? NULL : tclObjToPyTypedNested(interp, value);
+                if (pValue == NULL || PyDict_SetItem(pdict, pKey, pValue) < 0) {
+                    Py_XDECREF(pKey);
+                    Py_XDECREF(pValue);
+                    Py_DECREF(pdict);
+                    Tcl_DictObjDone(&search);
+                    return NULL;
+                }
+                Py_DECREF(pKey);
+                Py_DECREF(pValue);
+            }
+            return pdict;
+        }
+    }
+
+    return tohil_TclObjToPyUnicodeAsIs(interp, obj);
+}
+
+//
+// tclListObjToPyDictTyped - turn a tcl list of key-value pairs into a
+//   python dict, with the values converted by tclObjToPyTyped
+//
+static PyObject *
+tclListObjToPyDictTyped(Tcl_Interp *interp, Tcl_Obj *inputObj)
+{
+    Tcl_Obj **list;
+    int count;
+
+    if (Tcl_ListObjGetElements(interp, inputObj, &count, &list) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return NULL;
+    }
+
+    if (count % 2 != 0) {
+        // list doesn't have an even number of elements
+        PyErr_SetString(PyExc_TypeError, "list doesn't have an even number of elements");
+        return NULL;
+    }
+
+    PyObject *pdict = PyDict_New();
+    if (pdict == NULL)
+        return NULL;
+
+    for (int i = 0; i < count; i += 2) {
+        PyObject *pKey = tohil_TclObjToPyKey(interp, list[i]);
+        PyObject *pValue = (pKey == NULL) ? NULL : tclObjToPyTypedNested(interp, list[i + 1]);
+        if (pValue == NULL || PyDict_SetItem(pdict, pKey, pValue) < 0) {
+            Py_XDECREF(pKey);
+            Py_XDECREF(pValue);
+            Py_DECREF(pdict);
+            return NULL;
+        }
+        Py_DECREF(pKey);
+        Py_DECREF(pValue);
+    }
+
+    return pdict;
+}
+
+//
+// python to tcl conversion
+//
+// containers (sequences, sets and mappings) nest, and converting them
+// used to recurse once per level, so deep enough data could blow the C
+// stack and take down the whole process.  now the containers being
+// converted live on an explicit stack, and nesting past the conversion
+// depth limit raises RecursionError.  that also catches self-referential
+// containers, which used to recurse forever.
+//
+
+// how deep containers can nest before we give up
+#define TOHIL_DEFAULT_CONVERSION_DEPTH_LIMIT 1000
+static int tohil_conversion_depth_limit = TOHIL_DEFAULT_CONVERSION_DEPTH_LIMIT;
+
+// stack frames in the initial, on-the-C-stack frame array; deeper
+// conversions get a frame array from the heap
+#define TOHIL_STATIC_CONV_FRAMES 16
+
+enum TohilConvKind {
+    TOHIL_CONV_LEAF,
+    TOHIL_CONV_LIST,     // exactly a python list
+    TOHIL_CONV_TUPLE,    // exactly a python tuple
+    TOHIL_CONV_SEQUENCE, // anything else with the sequence protocol
+    TOHIL_CONV_SET,      // sets, by way of an iterator
+    TOHIL_CONV_DICT,     // exactly a python dict
+    TOHIL_CONV_MAPPING   // anything else with the mapping protocol
+};
+
+typedef struct {
+    enum TohilConvKind kind;
+    PyObject *pObj;    // the container, a new reference
+    PyObject *pSource; // iterator (sets) or items list (mappings), a new reference
+    PyObject *pValue;  // dict value waiting for its key to be converted, a new reference
+    Tcl_Obj *tObj;     // the tcl dict being built, for dicts and mappings
+    Tcl_Obj *tKey;     // mapping key waiting for its value, holds a reference
+    Tcl_Obj **objv;    // converted elements, for everything else
+    int objc;
+    int objvSize;
+    Py_ssize_t i;
+    Py_ssize_t len;
+} TohilConvFrame;
+
+//
+// tohil_unsigned_to_tcl - make a tcl integer from an unsigned value
+//   that might be too big for a wide int
+//
+static Tcl_Obj *
+tohil_unsigned_to_tcl(unsigned long long value)
+{
+    if (value <= (unsigned long long)LLONG_MAX)
+        return Tcl_NewWideIntObj((Tcl_WideInt)value);
+
+    // tcl's tommath allocates with ckalloc, which panics rather than
+    // failing, so this can't fail
+    mp_int big;
+    mp_init_size(&big, (64 + MP_DIGIT_BIT - 1) / MP_DIGIT_BIT);
+    int used = 0;
+    for (; value != 0; value >>= MP_DIGIT_BIT)
+        big.dp[used++] = (mp_digit)(value & MP_MASK);
+    big.used = used;
+    big.sign = MP_ZPOS;
+
+    // tcl takes over the digits
+    return Tcl_NewBignumObj(&big);
+}
+
+//
+// pyBufferToTcl - convert a python object that exposes the buffer
+//   protocol straight from its memory.  1-dimensional unsigned bytes,
+//   from bytearray, memoryviews of bytes and the like, become a tcl
+//   byte array.  1-dimensional buffers of native numbers, like
+//   array.array, become a tcl list of ints, doubles or booleans, and
+//   0-dimensional ones, like numpy scalars, a single number.
+//
+//   returns NULL without an exception set if the buffer isn't something
+//   we handle, in which case the caller should convert the object some
+//   other way.
+//
+static Tcl_Obj *
+pyBufferToTcl(Tcl_Interp *interp, PyObject *pObj)
+{
+    Py_buffer view;
+
+    if (PyObject_GetBuffer(pObj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        // not contiguous, or something; let someone else deal with it
+        PyErr_Clear();
+        return NULL;
+    }
+
+    const char *format = (view.format == NULL) ? "B" : view.format;
+    if (*format == '@')
+        format++;
+
+    Tcl_Obj *tObj = NULL;
+    if (view.ndim == 1 && view.itemsize == 1 && (STREQU(format, "B") || STREQU(format, "c"))) {
+        if (view.len <= INT_MAX)
+            tObj = Tcl_NewByteArrayObj((const unsigned char *)view.buf, (int)view.len);
+        PyBuffer_Release(&view);
+        return tObj;
+    }
+
+    if (view.ndim > 1 || format[0] == '\0' || format[1] != '\0' || view.len / view.itemsize > INT_MAX) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    int count = (int)(view.len / view.itemsize);
+    const char *p = (const char *)view.buf;
+    Tcl_Obj **objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * (count ? count : 1));
+
+    // a format with a byte order or size prefix, or an exporter that
+    // misreports its itemsize, could disagree with the native size of
+    // the format's C type.  stepping by one while counting by the other
+    // would run off the end of the buffer, so leave those to the caller.
+#define TOHIL_UNPACK(CTYPE, NEWOBJ)                        \
+    if (view.itemsize != sizeof(CTYPE))                    \
+        goto unhandled;                                    \
+    for (int i = 0; i < count; i++, p += sizeof(CTYPE)) { \
+        CTYPE value;                                       \
+        memcpy(&value, p, sizeof(CTYPE));                  \
+        objv[i] = NEWOBJ;                                  \
+    }                                                      \
+    break;
+
+    switch (format[0]) {
+    case 'b':
+        TOHIL_UNPACK(signed char, Tcl_NewIntObj(value))
+    case 'B':
+        TOHIL_UNPACK(unsigned char, Tcl_NewIntObj(value))
+    case 'h':
+        TOHIL_UNPACK(short, Tcl_NewIntObj(value))
+    case 'H':
+        TOHIL_UNPACK(unsigned short, Tcl_NewIntObj(value))
+    case 'i':
+        TOHIL_UNPACK(int, Tcl_NewIntObj(value))
+    case 'I':
+        TOHIL_UNPACK(unsigned int, Tcl_NewWideIntObj(value))
+    case 'l':
+        TOHIL_UNPACK(long, Tcl_NewWideIntObj(value))
+    case 'q':
+        TOHIL_UNPACK(long long, Tcl_NewWideIntObj(value))
+    case 'n':
+        TOHIL_UNPACK(Py_ssize_t, Tcl_NewWideIntObj(value))
+    case 'L':
+        TOHIL_UNPACK(unsigned long, tohil_unsigned_to_tcl(value))
+    case 'Q':
+        TOHIL_UNPACK(unsigned long long, tohil_unsigned_to_tcl(value))
+    case 'N':
+        TOHIL_UNPACK(size_t, tohil_unsigned_to_tcl(value))
+    case 'f':
+        TOHIL_UNPACK(float, Tcl_NewDoubleObj(value))
+    case 'd':
+        TOHIL_UNPACK(double, Tcl_NewDoubleObj(value))
+    case '?':
+        TOHIL_UNPACK(_Bool, Tcl_NewBooleanObj(value))
+    default:
+        // half floats, structs, pointers and so on
+        goto unhandled;
+    }
+#undef TOHIL_UNPACK
+
+    if (view.ndim == 0) {
+        // a scalar
+        assert(count == 1);
+        tObj = objv[0];
+    } else {
+        tObj = Tcl_NewListObj(count, objv);
+    }
+    ckfree(objv);
+    PyBuffer_Release(&view);
+    return tObj;
+
+unhandled:
+    ckfree(objv);
+    PyBuffer_Release(&view);
+    return NULL;
+}
+
+//
+// per-type conversion
+//
+// which way pyLeafToTcl converts an object depends only on its type, so
+// for anything but the commonest exact types, the answer is worked out
+// once per type and remembered in the interpreter's type cache.  the
+// cache is keyed by type object and checked against the type's version
+// tag, which python changes whenever the type is modified, so a type
+// that gains or loses a protocol, or a new type reusing a freed one's
+// address, gets looked at afresh.
+//
+// tohil.register_converter can name a python callable to convert a type
+// and its subclasses.  the registry is consulted when a type's way of
+// converting is worked out, and changing it empties the type cache.
+//
+enum TohilTypeBranch {
+    TOHIL_BRANCH_TCLOBJ,
+    TOHIL_BRANCH_BYTES,
+    TOHIL_BRANCH_UNICODE,
+    TOHIL_BRANCH_BUFFER, // if that fails, the branch it would otherwise take
+    TOHIL_BRANCH_NUMBER,
+    TOHIL_BRANCH_CONTAINER,
+    TOHIL_BRANCH_STR,
+    TOHIL_BRANCH_CONVERTER
+};
+
+typedef struct {
+    unsigned int versionTag;
+    enum TohilTypeBranch branch;
+    enum TohilConvKind convKind; // for TOHIL_BRANCH_CONTAINER
+    PyObject *converter;         // for TOHIL_BRANCH_CONVERTER, borrowed from the registry
+} TohilTypeCacheEntry;
+
+//
+// tohil_type_cache_clear - forget every type in the interpreter's type cache
+//
+static void
+tohil_type_cache_clear(TohilPyterps *pyterps)
+{
+    Tcl_HashSearch search;
+    for (Tcl_HashEntry *hashEntry = Tcl_FirstHashEntry(&pyterps->typeCache, &search); hashEntry != NULL;
+         hashEntry = Tcl_NextHashEntry(&search)) {
+        ckfree(Tcl_GetHashValue(hashEntry));
+    }
+    Tcl_DeleteHashTable(&pyterps->typeCache);
+    Tcl_InitHashTable(&pyterps->typeCache, TCL_ONE_WORD_KEYS);
+}
+
+//
+// tohil_type_branch - work out how objects of pObj's type convert to tcl,
+//   by the protocols they support.  if skipBuffer is set, it's what they
+//   convert as when the buffer protocol didn't work out.
+//
+//   the ordering must always be more 'specific' types first. E.g. a
+//   string also obeys the sequence protocol...but we probably want it
+//   to be a string rather than a list.
+//
+static void
+tohil_type_branch(PyObject *pObj, int skipBuffer, TohilTypeCacheEntry *entry)
+{
+    entry->convKind = TOHIL_CONV_LEAF;
+    entry->converter = NULL;
+
+    if (TohilTclObj_Check(pObj) || TohilTclDict_Check(pObj)) {
+        entry->branch = TOHIL_BRANCH_TCLOBJ;
+    } else if (PyBytes_Check(pObj)) {
+        entry->branch = TOHIL_BRANCH_BYTES;
+    } else if (PyUnicode_Check(pObj)) {
+        entry->branch = TOHIL_BRANCH_UNICODE;
+    } else if (!skipBuffer && PyObject_CheckBuffer(pObj)) {
+        entry->branch = TOHIL_BRANCH_BUFFER;
+    } else if (PyNumber_Check(pObj)) {
+        entry->branch = TOHIL_BRANCH_NUMBER;
+    } else {
+        entry->branch = TOHIL_BRANCH_CONTAINER;
+        if (PySequence_Check(pObj)) {
+            entry->convKind = TOHIL_CONV_SEQUENCE;
+        } else if (PySet_Check(pObj)) {
+            entry->convKind = TOHIL_CONV_SET;
+        } else if (PyMapping_Check(pObj)) {
+            entry->convKind = TOHIL_CONV_MAPPING;
+        } else {
+            entry->branch = TOHIL_BRANCH_STR;
+        }
+    }
+}
+
+//
+// tohil_type_lookup - fill in how objects of pObj's type convert to tcl,
+//   from the type cache if it's there.  returns -1 with a python
+//   exception set if looking up a registered converter failed.
+//
+static int
+tohil_type_lookup(Tcl_Interp *interp, PyObject *pObj, TohilTypeCacheEntry *entry)
+{
+    PyTypeObject *type = Py_TYPE(pObj);
+    TohilPyterps *pyterps = (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    Tcl_HashEntry *hashEntry = NULL;
+    int cacheable = pyterps != NULL && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG);
+
+    if (cacheable) {
+        hashEntry = Tcl_FindHashEntry(&pyterps->typeCache, (char *)type);
+        if (hashEntry != NULL) {
+            TohilTypeCacheEntry *cached = (TohilTypeCacheEntry *)Tcl_GetHashValue(hashEntry);
+            if (cached->versionTag == type->tp_version_tag) {
+                *entry = *cached;
+                return 0;
+            }
+        }
+    }
+
+    tohil_type_branch(pObj, 0, entry);
+
+    // a registered converter for the type or one it inherits from wins
+    if (pyterps != NULL && pyterps->converters != NULL && PyDict_GET_SIZE(pyterps->converters) > 0) {
+        PyObject *mro = type->tp_mro;
+        for (Py_ssize_t i = 0; mro != NULL && i < PyTuple_GET_SIZE(mro); i++) {
+            PyObject *converter = PyDict_GetItemWithError(pyterps->converters, PyTuple_GET_ITEM(mro, i));
+            if (converter != NULL) {
+                entry->branch = TOHIL_BRANCH_CONVERTER;
+                entry->converter = converter;
+                break;
+            }
+            if (PyErr_Occurred())
+                return -1;
+        }
+    }
+
+    if (!cacheable)
+        return 0;
+
+    entry->versionTag = type->tp_version_tag;
+    if (hashEntry == NULL) {
+        if (pyterps->typeCache.numEntries >= TOHIL_TYPE_CACHE_SIZE)
+            tohil_type_cache_clear(pyterps);
+        int isNew;
+        hashEntry = Tcl_CreateHashEntry(&pyterps->typeCache, (char *)type, &isNew);
+        Tcl_SetHashValue(hashEntry, ckalloc(sizeof(TohilTypeCacheEntry)));
+    }
+    *(TohilTypeCacheEntry *)Tcl_GetHashValue(hashEntry) = *entry;
+    return 0;
+}
+
+//
+// tohil_PyNumberToTclObj - convert a python object with the number
+//   protocol to a tcl object
+//
+static Tcl_Obj *
+tohil_PyNumberToTclObj(Tcl_Interp *interp, PyObject *pObj)
+{
+    PyObject *pStrObj;
+
+    if (PyLong_Check(pObj)) {
+        int overflow = 0;
+        // try long conversion
+        long longValue = PyLong_AsLongAndOverflow(pObj, &overflow);
+        if (!overflow) {
+            if (longValue == -1 && PyErr_Occurred())
+                return NULL;
+            return Tcl_NewLongObj(longValue);
+        }
+
+        // not big enough try long long conversion
+        overflow = 0;
+        Tcl_WideInt wideValue = PyLong_AsLongLongAndOverflow(pObj, &overflow);
+        if (!overflow) {
+            return Tcl_NewWideIntObj(wideValue);
+        }
+        // still not big enough, make a tcl bignum
+        return tohil_PyLong_to_TclBignum(pObj);
+    } else if (PyFloat_Check(pObj)) {
+        // it's float, effeciently get it from python
+        // to tcl
+        double doubleValue = PyFloat_AsDouble(pObj);
+        if (doubleValue == -1.0 && PyErr_Occurred()) {
+            return NULL;
+        }
+        return Tcl_NewDoubleObj(doubleValue);
+    }
+
+    // complex, decimal or some other kind of number, punt to string
+    pStrObj = PyObject_Str(pObj);
+    if (pStrObj == NULL)
+        return NULL;
+    Tcl_Obj *tObj = tohil_PyUnicodeToTclObj(interp, pStrObj);
+    Py_DECREF(pStrObj);
+    return tObj;
+}
+
+//
+// tohil_convert_with_converter - convert a python object to tcl by calling
+//   a registered converter on it and converting what that returns
+//
+static Tcl_Obj *
+tohil_convert_with_converter(Tcl_Interp *interp, PyObject *converter, PyObject *pObj)
+{
+    // the registry could change while the converter runs
+    Py_INCREF(converter);
+    PyObject *pResult = PyObject_CallOneArg(converter, pObj);
+    Py_DECREF(converter);
+    if (pResult == NULL)
+        return NULL;
+
+    // a converter returning something that needs converting again,
+    // and again, is caught by python's recursion limit
+    if (Py_EnterRecursiveCall(" while converting a python object to tcl")) {
+        Py_DECREF(pResult);
+        return NULL;
+    }
+
+    Tcl_Obj *tObj;
+    if ((TohilTclObj_Check(pResult) || TohilTclDict_Check(pResult)) && Py_REFCNT(pResult) == 1) {
+        // nothing else is keeping the tclobj's tcl object alive
+        tObj = TohilTclObj_objptr((TohilTclObj *)pResult);
+        if (tObj != NULL)
+            tObj = Tcl_DuplicateObj(tObj);
+    } else {
+        tObj = pyObjToTcl(interp, pResult);
+    }
+
+    Py_LeaveRecursiveCall();
+    Py_DECREF(pResult);
+    return tObj;
+}
+
+//
+// pyLeafToTcl - convert a python object that isn't a container to a
+//   tcl object.  if it is a container, returns NULL without setting
+//   an exception and sets *kindPtr to say what kind of container.
+//
+//   the commonest exact types are handled straight off.  anything else
+//   converts the way tohil_type_lookup says its type does:
+//
+//   - tclobj, tcldict -> their tcl object
+//   - bytes -> tcl byte array
+//   - str -> tcl string
+//   - buffer protocol -> tcl byte array or list of numbers
+//   - number protocol -> tcl number
+//   - sequence protocol -> tcl list
+//   - set -> tcl list
+//   - mapping protocol -> tcl dict
+//   - registered with tohil.register_converter -> whatever the converter returns
+//   - other -> the string from str()
+//
+//   Note that the sequence and mapping protocol are both determined by __getitem__,
+//   the only difference is that dict subclasses are excluded from sequence.
+//
+static Tcl_Obj *
+pyLeafToTcl(Tcl_Interp *interp, PyObject *pObj, enum TohilConvKind *kindPtr)
+{
+    PyTypeObject *type = Py_TYPE(pObj);
+    Tcl_Obj *tObj;
+
+    *kindPtr = TOHIL_CONV_LEAF;
+
+    if (pObj == Py_None) {
+        return Tcl_NewObj();
+    } else if (pObj == Py_True || pObj == Py_False) {
+        return Tcl_NewBooleanObj(pObj == Py_True);
+    } else if (type == &PyUnicode_Type) {
+        return tohil_PyUnicodeToTclObj(interp, pObj);
+    } else if (type == &PyLong_Type || type == &PyFloat_Type) {
+        return tohil_PyNumberToTclObj(interp, pObj);
+    } else if (type == &PyList_Type) {
+        *kindPtr = TOHIL_CONV_LIST;
+        return NULL;
+    } else if (type == &PyTuple_Type) {
+        *kindPtr = TOHIL_CONV_TUPLE;
+        return NULL;
+    } else if (type == &PyDict_Type) {
+        *kindPtr = TOHIL_CONV_DICT;
+        return NULL;
+    }
+
+    TohilTypeCacheEntry entry;
+    if (tohil_type_lookup(interp, pObj, &entry) < 0)
+        return NULL;
+
+    if (entry.branch == TOHIL_BRANCH_BUFFER) {
+        if ((tObj = pyBufferToTcl(interp, pObj)) != NULL || PyErr_Occurred())
+            return tObj;
+        tohil_type_branch(pObj, 1, &entry);
+    }
+
+    switch (entry.branch) {
+    case TOHIL_BRANCH_TCLOBJ:
+        return TohilTclObj_objptr((TohilTclObj *)pObj);
+
+    case TOHIL_BRANCH_BYTES:
+        return Tcl_NewByteArrayObj((const unsigned char *)PyBytes_AS_STRING(pObj), PyBytes_GET_SIZE(pObj));
+
+    case TOHIL_BRANCH_UNICODE:
+        return tohil_PyUnicodeToTclObj(interp, pObj);
+
+    case TOHIL_BRANCH_NUMBER:
+        return tohil_PyNumberToTclObj(interp, pObj);
+
+    case TOHIL_BRANCH_CONTAINER:
+        *kindPtr = entry.convKind;
+        return NULL;
+
+    case TOHIL_BRANCH_CONVERTER:
+        return tohil_convert_with_converter(interp, entry.converter, pObj);
+
+    default:
+        break;
+    }
+
+    // get python string representation of other objects
+    PyObject *pStrObj = PyObject_Str(pObj);
+    if (pStrObj == NULL)
+        return NULL;
+    tObj = tohil_PyUnicodeToTclObj(interp, pStrObj);
+    Py_DECREF(pStrObj);
+    return tObj;
+}
+
+//
+// tohil_conv_frame_start - set up a stack frame to convert a container
+//
+static int
+tohil_conv_frame_start(TohilConvFrame *frame, PyObject *pObj, enum TohilConvKind kind)
+{
+    Py_ssize_t sizeHint = 0;
+
+    frame->kind = kind;
+    frame->pObj = pObj;
+    frame->pSource = NULL;
+    frame->pValue = NULL;
+    frame->tObj = NULL;
+    frame->tKey = NULL;
+    frame->objv = NULL;
+    frame->objc = 0;
+    frame->objvSize = 0;
+    frame->i = 0;
+    frame->len = 0;
+    Py_INCREF(pObj);
+
+    switch (kind) {
+    case TOHIL_CONV_LIST:
+        // the list could change size while we convert its elements, so
+        // this is only a guess, and next checks the real size every time
+        sizeHint = PyList_GET_SIZE(pObj);
+        break;
+
+    case TOHIL_CONV_TUPLE:
+        sizeHint = frame->len = PyTuple_GET_SIZE(pObj);
+        break;
+
+    case TOHIL_CONV_SEQUENCE:
+        sizeHint = frame->len = PySequence_Length(pObj);
+        if (frame->len == -1)
+            return -1;
+        break;
+
+    case TOHIL_CONV_SET:
+        sizeHint = PyObject_LengthHint(pObj, 0);
+        if (sizeHint == -1)
+            return -1;
+        frame->pSource = PyObject_GetIter(pObj);
+        if (frame->pSource == NULL)
+            return -1;
+        break;
+
+    case TOHIL_CONV_DICT:
+        frame->len = PyDict_GET_SIZE(pObj);
+        frame->tObj = Tcl_NewDictObj();
+        return 0;
+
+    case TOHIL_CONV_MAPPING:
+        frame->pSource = PyMapping_Items(pObj);
+        if (frame->pSource == NULL)
+            return -1;
+        frame->len = PyList_GET_SIZE(frame->pSource);
+        frame->tObj = Tcl_NewDictObj();
+        return 0;
+
+    default:
+        assert(0);
+    }
+
+    if (sizeHint > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "too many elements to convert to a tcl list");
+        return -1;
+    }
+    if (sizeHint > 0) {
+        frame->objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * sizeHint);
+        frame->objvSize = (int)sizeHint;
+    }
+    return 0;
+}
+
+//
+// tohil_conv_frame_free - release everything a stack frame holds
+//
+static void
+tohil_conv_frame_free(TohilConvFrame *frame)
+{
+    Py_XDECREF(frame->pObj);
+    Py_XDECREF(frame->pSource);
+    Py_XDECREF(frame->pValue);
+    if (frame->tObj != NULL) {
+        Tcl_IncrRefCount(frame->tObj);
+        Tcl_DecrRefCount(frame->tObj);
+    }
+    if (frame->tKey != NULL)
+        Tcl_DecrRefCount(frame->tKey);
+    if (frame->objv != NULL) {
+        // the converted elements have no references of their own,
+        // unless they came from tclobjs, so free them this way
+        for (int i = 0; i < frame->objc; i++) {
+            Tcl_IncrRefCount(frame->objv[i]);
+            Tcl_DecrRefCount(frame->objv[i]);
+        }
+        ckfree(frame->objv);
+    }
+}
+
+//
+// tohil_conv_frame_finish - make the tcl object for a container that's
+//   been completely converted, and release what the frame holds
+//
+static Tcl_Obj *
+tohil_conv_frame_finish(TohilConvFrame *frame)
+{
+    Tcl_Obj *tObj = frame->tObj;
+    frame->tObj = NULL;
+
+    if (tObj == NULL) {
+        // Tcl_NewListObj takes its own references to the elements
+        tObj = Tcl_NewListObj(frame->objc, frame->objv);
+        frame->objc = 0;
+    }
+    tohil_conv_frame_free(frame);
+    return tObj;
+}
+
+//
+// tohil_conv_frame_next - get the next python object to convert for
+//   a container, as a new reference.  returns NULL with no exception
+//   set when the container is exhausted.
+//
+static PyObject *
+tohil_conv_frame_next(TohilConvFrame *frame)
+{
+    PyObject *pChild;
+
+    switch (frame->kind) {
+    case TOHIL_CONV_LIST:
+        if (frame->i >= PyList_GET_SIZE(frame->pObj))
+            return NULL;
+        pChild = PyList_GET_ITEM(frame->pObj, frame->i++);
+        Py_INCREF(pChild);
+        return pChild;
+
+    case TOHIL_CONV_TUPLE:
+        if (frame->i >= frame->len)
+            return NULL;
+        pChild = PyTuple_GET_ITEM(frame->pObj, frame->i++);
+        Py_INCREF(pChild);
+        return pChild;
+
+    case TOHIL_CONV_SEQUENCE:
+        if (frame->i >= frame->len)
+            return NULL;
+        return PySequence_GetItem(frame->pObj, frame->i++);
+
+    case TOHIL_CONV_SET:
+        return PyIter_Next(frame->pSource);
+
+    case TOHIL_CONV_DICT: {
+        // we fetch the key and then the value of each entry, holding
+        // on to the value while the key is converted
+        if (frame->tKey != NULL) {
+            pChild = frame->pValue;
+            frame->pValue = NULL;
+            return pChild;
+        }
+        if (PyDict_GET_SIZE(frame->pObj) != frame->len) {
+            PyErr_SetString(PyExc_RuntimeError, "dictionary changed size during conversion");
+            return NULL;
+        }
+        PyObject *pKey, *pValue;
+        if (!PyDict_Next(frame->pObj, &frame->i, &pKey, &pValue))
+            return NULL;
+        Py_INCREF(pValue);
+        frame->pValue = pValue;
+        Py_INCREF(pKey);
+        return pKey;
+    }
+
+    case TOHIL_CONV_MAPPING: {
+        if (frame->i >= frame->len)
+            return NULL;
+        PyObject *pItem = PyList_GET_ITEM(frame->pSource, frame->i);
+        if (!PyTuple_Check(pItem) || PyTuple_GET_SIZE(pItem) != 2) {
+            PyErr_SetString(PyExc_TypeError, "mapping items are not (key, value) tuples");
+            return NULL;
+        }
+        // we fetch the key and then the value of each item
+        pChild = PyTuple_GET_ITEM(pItem, frame->tKey == NULL ? 0 : 1);
+        if (frame->tKey != NULL)
+            frame->i++;
+        Py_INCREF(pChild);
+        return pChild;
+    }
+
+    default:
+        assert(0);
+        return NULL;
+    }
+}
+
+//
+// tohil_conv_frame_add - add a converted element to a container
+//
+static void
+tohil_conv_frame_add(Tcl_Interp *interp, TohilConvFrame *frame, Tcl_Obj *tObj)
+{
+    if (frame->kind != TOHIL_CONV_DICT && frame->kind != TOHIL_CONV_MAPPING) {
+        if (frame->objc == frame->objvSize) {
+            // the size we were given was wrong, or only a hint
+            frame->objvSize = frame->objvSize ? frame->objvSize * 2 : TOHIL_STATIC_OBJV_SIZE;
+            frame->objv = (Tcl_Obj **)ckrealloc(frame->objv, sizeof(Tcl_Obj *) * frame->objvSize);
+        }
+        frame->objv[frame->objc++] = tObj;
+    } else if (frame->tKey == NULL) {
+        frame->tKey = tObj;
+        Tcl_IncrRefCount(tObj);
+    } else {
+        Tcl_DictObjPut(interp, frame->tObj, frame->tKey, tObj);
+        Tcl_DecrRefCount(frame->tKey);
+        frame->tKey = NULL;
+    }
+}
+
+//
+// pyContainerToTcl - convert a python container to a tcl list or dict,
+//   converting the containers within it using an explicit stack
+//
+static Tcl_Obj *
+pyContainerToTcl(Tcl_Interp *interp, PyObject *pObj, enum TohilConvKind kind)
+{
+    TohilConvFrame staticFrames[TOHIL_STATIC_CONV_FRAMES];
+    TohilConvFrame *frames = staticFrames;
+    int nallocated = TOHIL_STATIC_CONV_FRAMES;
+    int depth = 0;
+    Tcl_Obj *tResult = NULL;
+
+    if (tohil_conversion_depth_limit < 1) {
+        PyErr_SetString(PyExc_RecursionError, "maximum conversion depth exceeded while converting python object to tcl");
+        return NULL;
+    }
+
+    if (tohil_conv_frame_start(&frames[depth++], pObj, kind) < 0)
+        goto cleanup;
+
+    while (depth > 0) {
+        TohilConvFrame *frame = &frames[depth - 1];
+        PyObject *pChild = tohil_conv_frame_next(frame);
+
+        if (pChild == NULL) {
+            if (PyErr_Occurred())
+                goto cleanup;
+
+            // this container is done; hand it to the one it's in, if any
+            Tcl_Obj *tObj = tohil_conv_frame_finish(frame);
+            depth--;
+
+            if (depth == 0) {
+                tResult = tObj;
+                break;
+            }
+            tohil_conv_frame_add(interp, &frames[depth - 1], tObj);
+            continue;
+        }
+
+        Tcl_Obj *tChild = pyLeafToTcl(interp, pChild, &kind);
+        if (kind == TOHIL_CONV_LEAF) {
+            Py_DECREF(pChild);
+            if (tChild == NULL)
+                goto cleanup;
+            tohil_conv_frame_add(interp, frame, tChild);
+            continue;
+        }
+
+        // the element is a container itself, push a frame for it
+        if (depth >= tohil_conversion_depth_limit) {
+            Py_DECREF(pChild);
+            PyErr_SetString(PyExc_RecursionError, "maximum conversion depth exceeded while converting python object to tcl");
+            goto cleanup;
+        }
+
+        if (depth == nallocated) {
+            int newsize = nallocated * 2;
+            TohilConvFrame *newFrames = (TohilConvFrame *)ckalloc(sizeof(TohilConvFrame) * newsize);
+            memcpy(newFrames, frames, sizeof(TohilConvFrame) * depth);
+            if (frames != staticFrames)
+                ckfree(frames);
+            frames = newFrames;
+            nallocated = newsize;
+        }
+
+        int startResult = tohil_conv_frame_start(&frames[depth++], pChild, kind);
+        Py_DECREF(pChild);
+        if (startResult < 0)
+            goto cleanup;
+    }
+
+cleanup:
+    while (depth > 0)
+        tohil_conv_frame_free(&frames[--depth]);
+    if (frames != staticFrames)
+        ckfree(frames);
+    return tResult;
+}
+
+//
+// convert a python object to a tcl object - amazing code by aidan
+//
+// returns NULL with a python exception set if the object can't be
+// converted
+//
 static Tcl_Obj *
 pyObjToTcl(Tcl_Interp *interp, PyObject *pObj)
 {
-    Tcl_Obj *ret = _pyObjToTcl(interp, pObj);
-    // NB tcl is not prepared to accept null pointers to set interpreter results
-    // and probably even variables and stuff yet pyObjToTcl can return them.
-    // here we look to detect if it does.  later we might choose to cause an
-    // error return or some kind, or, if necessary, do checks
-    // everywhere in the code that currently assumes pyObjToTcl can't fail
-    assert(ret != NULL);
-    if (ret == NULL)
-        abort();
-    return ret;
+    enum TohilConvKind kind;
+
+    // most objects aren't containers, convert them straight away
+    Tcl_Obj *tObj = pyLeafToTcl(interp, pObj, &kind);
+    if (kind == TOHIL_CONV_LEAF)
+        return tObj;
+    return pyContainerToTcl(interp, pObj, kind);
+}
+
+//
+// tohil_set_conversion_depth_limit - set how deeply python containers
+//   can nest when converting them to tcl
+//
+static PyObject *
+tohil_set_conversion_depth_limit(PyObject *self, PyObject *pLimit)
+{
+    int overflow;
+    long limit = PyLong_AsLongAndOverflow(pLimit, &overflow);
+    if (limit == -1 && PyErr_Occurred())
+        return NULL;
+
+    if (overflow || limit < 1 || limit > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "conversion depth limit must be a positive integer");
+        return NULL;
+    }
+
+    tohil_conversion_depth_limit = (int)limit;
+    Py_RETURN_NONE;
+}
+
+//
+// tohil_get_conversion_depth_limit - return the current conversion depth limit
+//
+static PyObject *
+tohil_get_conversion_depth_limit(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return PyLong_FromLong(tohil_conversion_depth_limit);
+}
+
+//
+// pyObjToTclForError - convert a python object to tcl while reporting
+//   an error, where failing again would lose the error we're trying to
+//   report.  if the conversion fails, substitutes a placeholder.
+//
+static Tcl_Obj *
+pyObjToTclForError(Tcl_Interp *interp, PyObject *pObj)
+{
+    Tcl_Obj *tObj = pyObjToTcl(interp, pObj);
+    if (tObj == NULL) {
+        PyErr_Clear();
+        tObj = Tcl_NewStringObj("(unable to convert python object to tcl)", -1);
+    }
+    return tObj;
 }
 
 //
@@ -802,7 +2181,7 @@ Tohil_ReturnStartupExceptionToTcl(Tcl_Interp *interp, PyThreadState *prior, char
     // NB pType contains the exception type; might want to do something with that
 
     // set tcl interpreter result to the error message
-    Tcl_SetObjResult(interp, pyObjToTcl(interp, pVal));
+    Tcl_SetObjResult(interp, pyObjToTclForError(interp, pVal));
 
     // add the description to tcl's error info
     Tcl_AddErrorInfo(interp, " (");
@@ -832,7 +2211,7 @@ Tohil_ReturnExceptionToTcl(Tcl_Interp *interp, PyThreadState *prior, char *descr
     // PyObject_Print(pVal, stdout, 0);
 
     // set tcl interpreter result
-    Tcl_SetObjResult(interp, pyObjToTcl(interp, pVal));
+    Tcl_SetObjResult(interp, pyObjToTclForError(interp, pVal));
 
     Tcl_AddErrorInfo(interp, " (");
     Tcl_AddErrorInfo(interp, description);
@@ -870,13 +2249,403 @@ Tohil_ReturnExceptionToTcl(Tcl_Interp *interp, PyThreadState *prior, char *descr
                                     "malfunction in tohil python exception handler, did not return tuple or tuple did not contain 2 elements");
     }
 
-    Tcl_SetObjErrorCode(interp, pyObjToTcl(interp, PyTuple_GET_ITEM(pExceptionResult, 0)));
-    Tcl_AppendObjToErrorInfo(interp, pyObjToTcl(interp, PyTuple_GET_ITEM(pExceptionResult, 1)));
+    Tcl_SetObjErrorCode(interp, pyObjToTclForError(interp, PyTuple_GET_ITEM(pExceptionResult, 0)));
+    Tcl_AppendObjToErrorInfo(interp, pyObjToTclForError(interp, PyTuple_GET_ITEM(pExceptionResult, 1)));
     Py_DECREF(pExceptionResult);
     tohil_restore_subinterp(prior);
     return TCL_ERROR;
 }
 
+//
+// string-keyed LRU caches
+//
+
+//
+// tohil_cache_init - set up an empty cache that will hold at most
+//   limit entries, calling freeProc on values as they are evicted
+//
+static void
+tohil_cache_init(TohilCache *cache, int limit, void (*freeProc)(void *value))
+{
+    Tcl_InitHashTable(&cache->table, TCL_STRING_KEYS);
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->size = 0;
+    cache->limit = limit;
+    cache->freeProc = freeProc;
+}
+
+//
+// tohil_cache_unlink - remove an entry from the cache's recently-used list
+//
+static void
+tohil_cache_unlink(TohilCache *cache, TohilCacheEntry *entry)
+{
+    if (entry->prev != NULL)
+        entry->prev->next = entry->next;
+    else
+        cache->head = entry->next;
+
+    if (entry->next != NULL)
+        entry->next->prev = entry->prev;
+    else
+        cache->tail = entry->prev;
+}
+
+//
+// tohil_cache_push - make an entry the most recently used one
+//
+static void
+tohil_cache_push(TohilCache *cache, TohilCacheEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if (cache->head != NULL)
+        cache->head->prev = entry;
+    cache->head = entry;
+    if (cache->tail == NULL)
+        cache->tail = entry;
+}
+
+//
+// tohil_cache_discard - unlink, free and forget a cache entry
+//
+static void
+tohil_cache_discard(TohilCache *cache, TohilCacheEntry *entry)
+{
+    tohil_cache_unlink(cache, entry);
+    Tcl_DeleteHashEntry(entry->hashEntry);
+    cache->freeProc(entry->value);
+    ckfree(entry);
+    cache->size--;
+}
+
+//
+// tohil_cache_get - return the value cached for key, or NULL if there
+//   isn't one.  a hit makes the entry the most recently used.
+//
+static void *
+tohil_cache_get(TohilCache *cache, const char *key)
+{
+    Tcl_HashEntry *hashEntry = Tcl_FindHashEntry(&cache->table, key);
+    if (hashEntry == NULL)
+        return NULL;
+
+    TohilCacheEntry *entry = (TohilCacheEntry *)Tcl_GetHashValue(hashEntry);
+    if (entry != cache->head) {
+        tohil_cache_unlink(cache, entry);
+        tohil_cache_push(cache, entry);
+    }
+    return entry->value;
+}
+
+//
+// tohil_cache_put - cache value under key, replacing (and freeing)
+//   any value already there, and evicting the least recently used
+//   entry if the cache is full
+//
+static void
+tohil_cache_put(TohilCache *cache, const char *key, void *value)
+{
+    int isNew;
+    Tcl_HashEntry *hashEntry = Tcl_CreateHashEntry(&cache->table, key, &isNew);
+
+    if (!isNew) {
+        TohilCacheEntry *entry = (TohilCacheEntry *)Tcl_GetHashValue(hashEntry);
+        cache->freeProc(entry->value);
+        entry->value = value;
+        if (entry != cache->head) {
+            tohil_cache_unlink(cache, entry);
+            tohil_cache_push(cache, entry);
+        }
+        return;
+    }
+
+    TohilCacheEntry *entry = (TohilCacheEntry *)ckalloc(sizeof(TohilCacheEntry));
+    entry->hashEntry = hashEntry;
+    entry->value = value;
+    Tcl_SetHashValue(hashEntry, entry);
+    tohil_cache_push(cache, entry);
+    cache->size++;
+
+    if (cache->size > cache->limit)
+        tohil_cache_discard(cache, cache->tail);
+}
+
+//
+// tohil_cache_delete - free everything in a cache, including
+//   its hash table
+//
+static void
+tohil_cache_delete(TohilCache *cache)
+{
+    while (cache->head != NULL)
+        tohil_cache_discard(cache, cache->head);
+    Tcl_DeleteHashTable(&cache->table);
+}
+
+//
+// tohil_pyobject_cache_free - free proc for caches holding plain python objects
+//
+static void
+tohil_pyobject_cache_free(void *value)
+{
+    Py_DECREF((PyObject *)value);
+}
+
+//
+// tohil_tclobj_cache_free - free proc for caches holding tcl objects
+//
+static void
+tohil_tclobj_cache_free(void *value)
+{
+    Tcl_DecrRefCount((Tcl_Obj *)value);
+}
+
+//
+// dict key cache
+//
+// tcl dicts and key-value lists coming over to python tend to use the
+// same few field names again and again.  rather than making a new str
+// for each key of each record, short keys are looked up by their tcl
+// string in a per-interpreter cache of interned strs.  every dict built
+// from them shares the same str objects, saving the allocations, and
+// looking them up in the dict later hits python's identity fast path.
+//
+
+//
+// tohil_TclObjToPyKey - return a new reference to an interned python str
+//   for a tcl object being used as a dict key
+//
+static PyObject *
+tohil_TclObjToPyKey(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    int tclStringSize;
+    char *tclString = Tcl_GetStringFromObj(obj, &tclStringSize);
+
+    TohilPyterps *pyterps = (interp == NULL) ? NULL : (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    if (pyterps == NULL || tclStringSize > TOHIL_KEY_CACHE_MAX_LENGTH)
+        return tohil_TclObjToPyUnicodeAsIs(interp, obj);
+
+    // tcl strings never contain a null byte, so the string
+    // is good as a key just as it is
+    PyObject *pKey = (PyObject *)tohil_cache_get(&pyterps->keyCache, tclString);
+    if (pKey != NULL) {
+        Py_INCREF(pKey);
+        return pKey;
+    }
+
+    pKey = tohil_TclStringToPyUnicode(interp, tclString, tclStringSize);
+    if (pKey == NULL)
+        return NULL;
+    PyUnicode_InternInPlace(&pKey);
+
+    Py_INCREF(pKey);
+    tohil_cache_put(&pyterps->keyCache, tclString, pKey);
+    return pKey;
+}
+
+//
+// tohil::call function resolution cache
+//
+// each entry remembers the callable a name resolved to, plus every
+// namespace dict lookup that led to it.  an entry is good for as long
+// as all of those dicts still map their names to the same objects,
+// so rebinding a function, reloading a module or replacing __main__
+// all cause the name to be resolved again.
+//
+typedef struct {
+    PyObject *dict;  // dict the name was looked up in
+    PyObject *name;  // interned name
+    PyObject *value; // what it was bound to, NULL if it had to be absent
+} TohilCallStep;
+
+typedef struct {
+    PyObject *fn;
+    int nsteps;
+    TohilCallStep steps[];
+} TohilCallCacheEntry;
+
+static void
+tohil_call_cache_free(void *value)
+{
+    TohilCallCacheEntry *entry = (TohilCallCacheEntry *)value;
+    for (int i = 0; i < entry->nsteps; i++) {
+        Py_DECREF(entry->steps[i].dict);
+        Py_DECREF(entry->steps[i].name);
+        Py_XDECREF(entry->steps[i].value);
+    }
+    Py_XDECREF(entry->fn);
+    ckfree(entry);
+}
+
+//
+// tohil_call_cache_valid - return true if a cached resolution is still good
+//
+static int
+tohil_call_cache_valid(TohilCallCacheEntry *entry)
+{
+    for (int i = 0; i < entry->nsteps; i++) {
+        TohilCallStep *step = &entry->steps[i];
+        if (PyDict_GetItem(step->dict, step->name) != step->value)
+            return 0;
+    }
+    return 1;
+}
+
+//
+// tohil_call_cache_add_step - record a lookup of name in a module
+//   that produced value.  returns 0, and records nothing, if the
+//   value didn't come straight out of the module's dict.
+//
+static int
+tohil_call_cache_add_step(TohilCallCacheEntry *entry, PyObject *dict, PyObject *name, PyObject *value)
+{
+    if (PyDict_GetItem(dict, name) != value)
+        return 0;
+
+    TohilCallStep *step = &entry->steps[entry->nsteps++];
+    Py_INCREF(dict);
+    step->dict = dict;
+    Py_INCREF(name);
+    step->name = name;
+    Py_XINCREF(value);
+    step->value = value;
+    return 1;
+}
+
+//
+// tohil_resolve_callable - find the python object for a tohil::call
+//   function name.  the name can be dotted, and is resolved starting
+//   from __main__, with undotted names falling back to builtins.
+//
+//   returns a new reference, or NULL with a python exception set and
+//   *descriptionPtr set to something suitable to say about it to tcl.
+//
+static PyObject *
+tohil_resolve_callable(Tcl_Interp *interp, Tcl_Obj *nameObj, char **descriptionPtr)
+{
+    TohilPyterps *pyterps = (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    const char *key = Tcl_GetString(nameObj);
+
+    TohilCallCacheEntry *cached = (TohilCallCacheEntry *)tohil_cache_get(&pyterps->callCache, key);
+    if (cached != NULL && tohil_call_cache_valid(cached)) {
+        Py_INCREF(cached->fn);
+        return cached->fn;
+    }
+
+    Tcl_DString objandfn_ds;
+    const char *objandfn = tohil_TclObjToUTF8DString(interp, nameObj, &objandfn_ds);
+
+    // we need a step for sys.modules, one per name segment, and
+    // one more for the builtins fallback
+    int nsteps = 3;
+    for (const char *p = objandfn; *p != '\0'; p++) {
+        if (*p == '.')
+            nsteps++;
+    }
+    TohilCallCacheEntry *entry = (TohilCallCacheEntry *)ckalloc(sizeof(TohilCallCacheEntry) + nsteps * sizeof(TohilCallStep));
+    entry->fn = NULL;
+    entry->nsteps = 0;
+
+    /* Borrowed ref, do not decrement */
+    PyObject *pMainModule = PyImport_AddModule("__main__");
+    if (pMainModule == NULL) {
+        *descriptionPtr = "unable to add module __main__ to python interpreter";
+        goto fail;
+    }
+
+    PyObject *pMainStr = PyUnicode_InternFromString("__main__");
+    int cacheable = tohil_call_cache_add_step(entry, PyImport_GetModuleDict(), pMainStr, pMainModule);
+    Py_DECREF(pMainStr);
+
+    /* So we don't have to special case the decref in the following loop */
+    Py_INCREF(pMainModule);
+    PyObject *pObjParent = NULL;
+    PyObject *pObj = pMainModule;
+    PyObject *pObjStr = NULL;
+    char *dot = index(objandfn, '.');
+    while (dot != NULL) {
+        pObjParent = pObj;
+
+        pObjStr = PyUnicode_FromStringAndSize(objandfn, dot - objandfn);
+        if (pObjStr == NULL) {
+            Py_DECREF(pObjParent);
+            *descriptionPtr = "failed unicode translation of call function in python interpreter";
+            goto fail;
+        }
+        PyUnicode_InternInPlace(&pObjStr);
+
+        pObj = PyObject_GetAttr(pObjParent, pObjStr);
+        if (pObj != NULL && cacheable) {
+            cacheable = PyModule_Check(pObjParent) && tohil_call_cache_add_step(entry, PyModule_GetDict(pObjParent), pObjStr, pObj);
+        }
+        Py_DECREF(pObjStr);
+        Py_DECREF(pObjParent);
+        if (pObj == NULL) {
+            *descriptionPtr = "failed to find dotted attribute in python interpreter";
+            goto fail;
+        }
+
+        objandfn = dot + 1;
+        dot = index(objandfn, '.');
+    }
+
+    pObjStr = PyUnicode_InternFromString(objandfn);
+    if (pObjStr == NULL) {
+        Py_DECREF(pObj);
+        *descriptionPtr = "failed unicode translation of call function in python interpreter";
+        goto fail;
+    }
+    PyObject *pFn = PyObject_GetAttr(pObj, pObjStr);
+
+    if (pFn != NULL) {
+        if (cacheable) {
+            cacheable = PyModule_Check(pObj) && tohil_call_cache_add_step(entry, PyModule_GetDict(pObj), pObjStr, pFn);
+        }
+    } else if (pObjParent == NULL) {
+        // if we didn't find anything and we weren't invoked with dotted notation,
+        // check builtins
+        // (PyObject_GetAttr raised an exception above if pFn is null)
+        PyErr_Clear();
+
+        PyObject *builtins = PyEval_GetBuiltins();
+        pFn = PyDict_GetItem(builtins, pObjStr);
+        Py_XINCREF(pFn);
+        if (pFn != NULL && cacheable) {
+            cacheable = tohil_call_cache_add_step(entry, PyModule_GetDict(pObj), pObjStr, NULL) &&
+                        tohil_call_cache_add_step(entry, builtins, pObjStr, pFn);
+        }
+    }
+
+    Py_DECREF(pObjStr);
+    Py_DECREF(pObj);
+
+    if (pFn == NULL) {
+#define CALL_ERROR_STRING_SIZE 256
+        char errorString[CALL_ERROR_STRING_SIZE];
+        snprintf(errorString, CALL_ERROR_STRING_SIZE, "name '%.200s' is not defined.", objandfn);
+        PyErr_SetString(PyExc_NameError, errorString);
+        *descriptionPtr = "failed to find object/function in python interpreter";
+        goto fail;
+    }
+    Tcl_DStringFree(&objandfn_ds);
+
+    if (cacheable) {
+        Py_INCREF(pFn);
+        entry->fn = pFn;
+        tohil_cache_put(&pyterps->callCache, key, entry);
+    } else {
+        tohil_call_cache_free(entry);
+    }
+    return pFn;
+
+fail:
+    Tcl_DStringFree(&objandfn_ds);
+    tohil_call_cache_free(entry);
+    return NULL;
+}
+
 //
 // subinterpreter support
 //
@@ -900,14 +2669,33 @@ tohil_delete_subinterp(ClientData clientData, Tcl_Interp *interp)
     // printf("tohil_delete_subinterp: tcl interp %p, parent python interp %p, subinterp %p\n", interp, pyterps->parent, pyterps->child);
     assert(pyterps->parent != NULL);
 
+    tohil_cache_delete(&pyterps->scriptCache);
+    tohil_cache_delete(&pyterps->exprCache);
+    tohil_type_cache_clear(pyterps);
+    Tcl_DeleteHashTable(&pyterps->typeCache);
+
     if (pyterps->parent == pyterps->child) {
         // printf("tohil_delete_subinterp: main python interpreter, not deleting\n");
+        // the caches hold python objects, so only let go of them if
+        // python is still around to take them back
+        if (Py_IsInitialized() && PyGILState_Check()) {
+            tohil_cache_delete(&pyterps->callCache);
+            tohil_cache_delete(&pyterps->evalCodeCache);
+            tohil_cache_delete(&pyterps->execCodeCache);
+            tohil_cache_delete(&pyterps->keyCache);
+            Py_CLEAR(pyterps->converters);
+        }
         return;
     }
 
     // printf("tcl interpreter %p being deleted, deleting subinterp %p, switching python threadstate to %p\n", interp, pyterps->child, pyterps->parent);
     // the python subinterp being deleted has to be the current threadstate
     PyThreadState_Swap(pyterps->child);
+    tohil_cache_delete(&pyterps->callCache);
+    tohil_cache_delete(&pyterps->evalCodeCache);
+    tohil_cache_delete(&pyterps->execCodeCache);
+    tohil_cache_delete(&pyterps->keyCache);
+    Py_CLEAR(pyterps->converters);
     Py_EndInterpreter(pyterps->child);
 
     // now switch back to the parent interpreter's thread state
@@ -927,6 +2715,14 @@ tohil_associate_subinterp(Tcl_Interp *interp, PyThreadState *parent, PyThreadSta
     TohilPyterps *pyterps = (TohilPyterps *)ckalloc(sizeof(TohilPyterps));
     pyterps->parent = parent;
     pyterps->child = child;
+    tohil_cache_init(&pyterps->callCache, TOHIL_CALL_CACHE_SIZE, tohil_call_cache_free);
+    tohil_cache_init(&pyterps->evalCodeCache, TOHIL_CODE_CACHE_SIZE, tohil_pyobject_cache_free);
+    tohil_cache_init(&pyterps->execCodeCache, TOHIL_CODE_CACHE_SIZE, tohil_pyobject_cache_free);
+    tohil_cache_init(&pyterps->scriptCache, TOHIL_SCRIPT_CACHE_SIZE, tohil_tclobj_cache_free);
+    tohil_cache_init(&pyterps->exprCache, TOHIL_SCRIPT_CACHE_SIZE, tohil_tclobj_cache_free);
+    tohil_cache_init(&pyterps->keyCache, TOHIL_KEY_CACHE_SIZE, tohil_pyobject_cache_free);
+    Tcl_InitHashTable(&pyterps->typeCache, TCL_ONE_WORD_KEYS);
+    pyterps->converters = NULL;
     Tcl_SetAssocData(interp, TOHIL_ASSOC_PYTERPS, tohil_delete_subinterp, (ClientData)pyterps);
     // printf("tohil_associate_subinterp: tcl interpreter %p, parent %p, child %p\n", interp, parent, child);
 }
@@ -1009,123 +2805,158 @@ tohil_setup_subinterp(Tcl_Interp *interp, enum SubinterpType subtype)
 }
 
 //
-// call python from tcl with very explicit arguments versus
-//   slamming stuff through eval
+// options shared by tohil::call and tohil::callmany
+//
+typedef struct {
+    Tcl_Obj *kwListObj;       // -kwlist value, or NULL
+    const char *nonevalue;    // -nonevalue word, in utf-8, or NULL
+    Tcl_DString nonevalue_ds; // holds nonevalue
+    int typed;                // -typed was given
+} TohilCallOptions;
+
+//
+// tohil_parse_call_options - parse the options at the start of a tohil::call
+//   or tohil::callmany command line, leaving *objStartPtr pointing at the first
+//   argument that isn't one.  at least nfixed arguments must follow the options.
+//
+//   returns TCL_ERROR, with nothing to free, if the options are bad, else TCL_OK,
+//   and tohil_free_call_options must be called when done with them.
 //
 static int
-TohilCall_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+tohil_parse_call_options(Tcl_Interp *interp, int objc, Tcl_Obj *const objv[], int nfixed, int *objStartPtr, TohilCallOptions *options)
 {
-    PyThreadState *prior = tohil_swap_subinterp(interp);
+    int objStart = 1;
 
-    if (objc < 2) {
-    wrongargs:
-        Tcl_WrongNumArgs(interp, 1, objv, "?-kwlist list? ?-nonevalue word? func ?arg ...?");
-        return tohil_tcl_return(interp, prior, TCL_ERROR);
-    }
+    options->kwListObj = NULL;
+    options->nonevalue = NULL;
+    options->typed = 0;
 
-    PyObject *kwObj = NULL;
-    Tcl_DString objandfn_ds;
-    const char *objandfn = tohil_TclObjToUTF8DString(interp, objv[1], &objandfn_ds);
-    Tcl_DString nonevalue_ds;
-    const char *nonevalue = NULL;
-    int objStart = 2;
-
-    while (objandfn[0] == '-') {
-        if (STREQU(objandfn, "-kwlist")) {
-            if (objc < 2 + objStart)
+    // options are plain ascii so we can look at them without converting
+    while (objStart < objc) {
+        const char *option = Tcl_GetString(objv[objStart]);
+        if (option[0] != '-')
+            break;
+        if (STREQU(option, "-kwlist")) {
+            if (objStart + 1 + nfixed >= objc)
                 goto wrongargs;
-            kwObj = tclListObjToPyDictObject(interp, objv[objStart]);
-            Tcl_DStringFree(&objandfn_ds);
-            objandfn = tohil_TclObjToUTF8DString(interp, objv[objStart + 1], &objandfn_ds);
+            options->kwListObj = objv[objStart + 1];
             objStart += 2;
-            if (kwObj == NULL) {
-                return tohil_tcl_return(interp, prior, TCL_ERROR);
-            }
             continue;
         }
-        if (STREQU(objandfn, "-nonevalue")) {
-            if (objc < 2 + objStart || nonevalue)
+        if (STREQU(option, "-nonevalue")) {
+            if (objStart + 1 + nfixed >= objc || options->nonevalue)
                 goto wrongargs;
-            nonevalue = tohil_TclObjToUTF8DString(interp, objv[objStart], &nonevalue_ds);
-            Tcl_DStringFree(&objandfn_ds);
-            objandfn = tohil_TclObjToUTF8DString(interp, objv[objStart + 1], &objandfn_ds);
+            options->nonevalue = tohil_TclObjToUTF8DString(interp, objv[objStart + 1], &options->nonevalue_ds);
             objStart += 2;
             continue;
         }
+        if (STREQU(option, "-typed")) {
+            if (objStart + nfixed >= objc)
+                goto wrongargs;
+            options->typed = 1;
+            objStart++;
+            continue;
+        }
         break;
     }
 
-    /* Borrowed ref, do not decrement */
-    PyObject *pMainModule = PyImport_AddModule("__main__");
-    if (pMainModule == NULL) {
-        Tcl_DStringFree(&objandfn_ds);
-        if (nonevalue)
-            Tcl_DStringFree(&nonevalue_ds);
-        return Tohil_ReturnExceptionToTcl(interp, prior, "unable to add module __main__ to python interpreter");
-    }
+    if (objStart + nfixed > objc)
+        goto wrongargs;
 
-    /* So we don't have to special case the decref in the following loop */
-    Py_INCREF(pMainModule);
-    PyObject *pObjParent = NULL;
-    PyObject *pObj = pMainModule;
-    PyObject *pObjStr = NULL;
-    char *dot = index(objandfn, '.');
-    while (dot != NULL) {
-        pObjParent = pObj;
+    *objStartPtr = objStart;
+    return TCL_OK;
 
-        pObjStr = PyUnicode_FromStringAndSize(objandfn, dot - objandfn);
-        if (pObjStr == NULL) {
-            Py_DECREF(pObjParent);
-            Tcl_DStringFree(&objandfn_ds);
-            if (nonevalue)
-                Tcl_DStringFree(&nonevalue_ds);
-            return Tohil_ReturnExceptionToTcl(interp, prior, "failed unicode translation of call function in python interpreter");
-        }
+wrongargs:
+    if (options->nonevalue)
+        Tcl_DStringFree(&options->nonevalue_ds);
+    options->nonevalue = NULL;
+    return TCL_ERROR;
+}
 
-        pObj = PyObject_GetAttr(pObjParent, pObjStr);
-        Py_DECREF(pObjStr);
-        Py_DECREF(pObjParent);
-        if (pObj == NULL) {
-            Tcl_DStringFree(&objandfn_ds);
-            if (nonevalue)
-                Tcl_DStringFree(&nonevalue_ds);
-            return Tohil_ReturnExceptionToTcl(interp, prior, "failed to find dotted attribute in python interpreter");
-        }
+static void
+tohil_free_call_options(TohilCallOptions *options)
+{
+    if (options->nonevalue)
+        Tcl_DStringFree(&options->nonevalue_ds);
+    options->nonevalue = NULL;
+}
 
-        objandfn = dot + 1;
-        dot = index(objandfn, '.');
+//
+// tohil_call_arg_to_py - convert an argument to a python function being
+//   called from tcl into a python object, according to the call's options.
+//   returns a new reference, or NULL with a python exception set.
+//
+static PyObject *
+tohil_call_arg_to_py(Tcl_Interp *interp, Tcl_Obj *obj, TohilCallOptions *options)
+{
+    if (tohil_TclObjIsNoneSentinel(obj, options->nonevalue)) {
+        Py_INCREF(Py_None);
+        return Py_None;
     }
+    if (options->typed)
+        return tclObjToPyTyped(interp, obj);
+    return tohil_TclObjToPyUnicode(interp, obj);
+}
 
-    PyObject *pFn = PyObject_GetAttrString(pObj, objandfn);
-
-
-    // if we didn't find anything and we weren't invoked with dotted notation,
-    // check builtins
-    if (pFn == NULL && pObjParent == NULL) {
-        // (PyObject_GetAttrString raised an exception above if pFn is null)
-        PyErr_Clear();
+//
+// tohil_call_prepare - set up for tohil::call and tohil::callmany: convert
+//   the -kwlist, if any, and find the function.  on failure, returns
+//   TCL_ERROR with a python exception set and *descriptionPtr set to say
+//   what went wrong.
+//
+static int
+tohil_call_prepare(Tcl_Interp *interp, Tcl_Obj *funcObj, TohilCallOptions *options, PyObject **pFnPtr, PyObject **kwObjPtr, char **descriptionPtr)
+{
+    PyObject *kwObj = NULL;
 
-        PyObject *builtins = PyEval_GetBuiltins();
-        pFn = PyDict_GetItemString(builtins, objandfn);
+    if (options->kwListObj != NULL) {
+        kwObj = options->typed ? tclListObjToPyDictTyped(interp, options->kwListObj) : tclListObjToPyDictObject(interp, options->kwListObj);
+        if (kwObj == NULL) {
+            *descriptionPtr = "unable to convert -kwlist to a python dict";
+            return TCL_ERROR;
+        }
     }
 
-    Py_DECREF(pObj);
-
+    PyObject *pFn = tohil_resolve_callable(interp, funcObj, descriptionPtr);
     if (pFn == NULL) {
-#define CALL_ERROR_STRING_SIZE 256
-        char errorString[CALL_ERROR_STRING_SIZE];
-        snprintf(errorString, CALL_ERROR_STRING_SIZE, "name '%.200s' is not defined.", objandfn);
-        Tcl_DStringFree(&objandfn_ds);
-        if (nonevalue)
-            Tcl_DStringFree(&nonevalue_ds);
-        PyErr_SetString(PyExc_NameError, errorString);
-        return Tohil_ReturnExceptionToTcl(interp, prior, "failed to find object/function in python interpreter");
+        Py_XDECREF(kwObj);
+        return TCL_ERROR;
     }
-    Tcl_DStringFree(&objandfn_ds);
 
     if (!PyCallable_Check(pFn)) {
         Py_DECREF(pFn);
-        return Tohil_ReturnExceptionToTcl(interp, prior, "function is not callable");
+        Py_XDECREF(kwObj);
+        PyErr_SetString(PyExc_TypeError, "function is not callable");
+        *descriptionPtr = "function is not callable";
+        return TCL_ERROR;
+    }
+
+    *pFnPtr = pFn;
+    *kwObjPtr = kwObj;
+    return TCL_OK;
+}
+
+//
+// call python from tcl with very explicit arguments versus
+//   slamming stuff through eval
+//
+static int
+TohilCall_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    PyThreadState *prior = tohil_swap_subinterp(interp);
+    TohilCallOptions options;
+    int objStart;
+
+    if (tohil_parse_call_options(interp, objc, objv, 1, &objStart, &options) != TCL_OK) {
+        Tcl_WrongNumArgs(interp, 1, objv, "?-kwlist list? ?-nonevalue word? ?-typed? func ?arg ...?");
+        return tohil_tcl_return(interp, prior, TCL_ERROR);
+    }
+
+    char *description = NULL;
+    PyObject *pFn, *kwObj;
+    if (tohil_call_prepare(interp, objv[objStart++], &options, &pFn, &kwObj, &description) != TCL_OK) {
+        tohil_free_call_options(&options);
+        return Tohil_ReturnExceptionToTcl(interp, prior, description);
     }
 
     // if there are no positional arguments, we will
@@ -1135,25 +2966,26 @@ TohilCall_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *cons
     // tuple should be used.
     int i;
     PyObject *pArgs = PyTuple_New(objc - objStart);
+    if (pArgs == NULL) {
+        Py_DECREF(pFn);
+        Py_XDECREF(kwObj);
+        tohil_free_call_options(&options);
+        return Tohil_ReturnExceptionToTcl(interp, prior, "unable to allocate arguments");
+    }
     PyObject *curarg = NULL;
     for (i = objStart; i < objc; i++) {
-        if (tohil_TclObjIsNoneSentinel(objv[i], nonevalue)) {
-            curarg = Py_None;
-        } else {
-            Tcl_DString ds;
-            curarg = PyUnicode_FromString(tohil_TclObjToUTF8DString(interp, objv[i], &ds));
-            Tcl_DStringFree(&ds);
-        }
+        curarg = tohil_call_arg_to_py(interp, objv[i], &options);
         if (curarg == NULL) {
             Py_DECREF(pArgs);
             Py_DECREF(pFn);
+            Py_XDECREF(kwObj);
+            tohil_free_call_options(&options);
             return Tohil_ReturnExceptionToTcl(interp, prior, "unicode string conversion failed");
         }
         /* Steals a reference */
         PyTuple_SET_ITEM(pArgs, i - objStart, curarg);
     }
-    if (nonevalue)
-        Tcl_DStringFree(&nonevalue_ds);
+    tohil_free_call_options(&options);
 
     PyObject *pRet = PyObject_Call(pFn, pArgs, kwObj);
     Py_DECREF(pFn);
@@ -1174,6 +3006,130 @@ TohilCall_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *cons
     return tohil_tcl_return(interp, prior, TCL_OK);
 }
 
+//
+// tohil::callmany - call a python function once for each list of arguments
+//   in a list of argument lists, returning a list of the results.
+//
+// it takes the same options as tohil::call, and the function is looked up
+// and the python interpreter swapped in just once for all the calls.
+// the first call that raises an exception stops things and becomes
+// a tcl error.
+//
+static int
+TohilCallMany_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    PyThreadState *prior = tohil_swap_subinterp(interp);
+    TohilCallOptions options;
+    int objStart;
+
+    if (tohil_parse_call_options(interp, objc, objv, 2, &objStart, &options) != TCL_OK || objStart + 2 != objc) {
+        tohil_free_call_options(&options);
+        Tcl_WrongNumArgs(interp, 1, objv, "?-kwlist list? ?-nonevalue word? ?-typed? func argLists");
+        return tohil_tcl_return(interp, prior, TCL_ERROR);
+    }
+
+    // iterate over a private copy of the argument lists, like foreach
+    // does.  a python function can get at the original, and if it
+    // uses it as something other than a list, say as a dict, the
+    // element array we're walking would be freed out from under us.
+    // the copy shares the elements, so this doesn't copy them.
+    int nrows;
+    Tcl_Obj **rows;
+    Tcl_Obj *argListsObj = Tcl_DuplicateObj(objv[objStart + 1]);
+    Tcl_IncrRefCount(argListsObj);
+    if (Tcl_ListObjGetElements(interp, argListsObj, &nrows, &rows) != TCL_OK) {
+        Tcl_DecrRefCount(argListsObj);
+        tohil_free_call_options(&options);
+        return tohil_tcl_return(interp, prior, TCL_ERROR);
+    }
+
+    char *description = NULL;
+    PyObject *pFn, *kwObj;
+    if (tohil_call_prepare(interp, objv[objStart], &options, &pFn, &kwObj, &description) != TCL_OK) {
+        Tcl_DecrRefCount(argListsObj);
+        tohil_free_call_options(&options);
+        return Tohil_ReturnExceptionToTcl(interp, prior, description);
+    }
+
+    Tcl_Obj *resultObj = Tcl_NewListObj(0, NULL);
+    PyObject *staticArgv[TOHIL_STATIC_OBJV_SIZE];
+    PyObject **argv = staticArgv;
+    int argvSize = TOHIL_STATIC_OBJV_SIZE;
+    int tcl_result = TCL_OK;
+
+    for (int row = 0; row < nrows; row++) {
+        int nargs;
+        Tcl_Obj **rowObjv;
+        int i;
+
+        if (Tcl_ListObjGetElements(interp, rows[row], &nargs, &rowObjv) != TCL_OK) {
+            tcl_result = TCL_ERROR;
+            break;
+        }
+
+        if (nargs > argvSize) {
+            if (argv != staticArgv)
+                ckfree(argv);
+            argv = (PyObject **)ckalloc(sizeof(PyObject *) * nargs);
+            argvSize = nargs;
+        }
+
+        for (i = 0; i < nargs; i++) {
+            argv[i] = tohil_call_arg_to_py(interp, rowObjv[i], &options);
+            if (argv[i] == NULL)
+                break;
+        }
+
+        PyObject *pRet = NULL;
+        if (i == nargs) {
+            if (kwObj == NULL) {
+                pRet = PyObject_Vectorcall(pFn, argv, nargs, NULL);
+            } else {
+                pRet = PyObject_VectorcallDict(pFn, argv, nargs, kwObj);
+            }
+        } else {
+            description = "unicode string conversion failed";
+        }
+
+        while (--i >= 0) {
+            Py_DECREF(argv[i]);
+        }
+
+        if (pRet == NULL) {
+            if (description == NULL)
+                description = "error in python object call";
+            tcl_result = TCL_ERROR;
+            break;
+        }
+
+        Tcl_Obj *tRet = pyObjToTcl(interp, pRet);
+        Py_DECREF(pRet);
+        if (tRet == NULL) {
+            description = "error converting python object to tcl object";
+            tcl_result = TCL_ERROR;
+            break;
+        }
+        Tcl_ListObjAppendElement(NULL, resultObj, tRet);
+    }
+
+    if (argv != staticArgv)
+        ckfree(argv);
+    Tcl_DecrRefCount(argListsObj);
+    Py_DECREF(pFn);
+    Py_XDECREF(kwObj);
+    tohil_free_call_options(&options);
+
+    if (tcl_result != TCL_OK) {
+        Tcl_DecrRefCount(resultObj);
+        if (PyErr_Occurred())
+            return Tohil_ReturnExceptionToTcl(interp, prior, description);
+        return tohil_tcl_return(interp, prior, TCL_ERROR);
+    }
+
+    Tcl_SetObjResult(interp, resultObj);
+    return tohil_tcl_return(interp, prior, TCL_OK);
+}
+
 //
 // implements tcl command tohil::import, to import a python module
 //   into the python interpreter.
@@ -1222,6 +3178,10 @@ TohilImport_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *co
 
 // common routine for evaluating isolated expressions or sequences of statements
 // from python
+//
+// compiled code objects are cached per interpreter, keyed by the source
+// string, so code that's run over and over again only gets undented and
+// compiled once.
 static int
 TohilExecEvalPython(int startSymbol, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
@@ -1231,27 +3191,50 @@ TohilExecEvalPython(int startSymbol, Tcl_Interp *interp, int objc, Tcl_Obj *cons
         Tcl_WrongNumArgs(interp, 1, objv, startSymbol == Py_eval_input ? "evalString" : "execString");
         return tohil_tcl_return(interp, prior, TCL_ERROR);
     }
-    Tcl_DString ds;
-    char *cmd = tohil_TclObjToUTF8DString(interp, objv[1], &ds);
-    if (startSymbol == Py_file_input) {
-        if (tohil_UndentPython(interp, cmd) == TCL_ERROR) {
-            Tcl_DStringFree(&ds);
-            return tohil_tcl_return(interp, prior, TCL_ERROR);
+
+    TohilPyterps *pyterps = (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    TohilCache *codeCache = (startSymbol == Py_eval_input) ? &pyterps->evalCodeCache : &pyterps->execCodeCache;
+    const char *key = Tcl_GetString(objv[1]);
+
+    PyObject *code = (PyObject *)tohil_cache_get(codeCache, key);
+    if (code == NULL) {
+        Tcl_DString ds;
+        char *cmd = tohil_TclObjToUTF8DString(interp, objv[1], &ds);
+        if (startSymbol == Py_file_input) {
+            if (tohil_UndentPython(interp, cmd) == TCL_ERROR) {
+                Tcl_DStringFree(&ds);
+                return tohil_tcl_return(interp, prior, TCL_ERROR);
+            }
+        }
+
+        code = Py_CompileStringExFlags(cmd, "<string>", startSymbol, NULL, -1);
+        Tcl_DStringFree(&ds);
+        if (code == NULL) {
+            return Tohil_ReturnExceptionToTcl(interp, prior, "while evaluating python code");
         }
+        tohil_cache_put(codeCache, key, code);
     }
 
-    // evaluate the command according to the start symbol
+    // hold our own reference, the code we run might push this
+    // code object out of the cache
+    Py_INCREF(code);
+
+    // evaluate the code in __main__
     PyObject *main_module = PyImport_AddModule("__main__");
     PyObject *global_dict = PyModule_GetDict(main_module);
-    PyObject *pyobj = PyRun_StringFlags(cmd, startSymbol, global_dict, global_dict, 0);
-    Tcl_DStringFree(&ds);
+    PyObject *pyobj = PyEval_EvalCode(code, global_dict, global_dict);
+    Py_DECREF(code);
 
     if (pyobj == NULL) {
         return Tohil_ReturnExceptionToTcl(interp, prior, "while evaluating python code");
     }
 
-    Tcl_SetObjResult(interp, pyObjToTcl(interp, pyobj));
-    Py_XDECREF(pyobj);
+    Tcl_Obj *resultObj = pyObjToTcl(interp, pyobj);
+    Py_DECREF(pyobj);
+    if (resultObj == NULL) {
+        return Tohil_ReturnExceptionToTcl(interp, prior, "error converting python object to tcl object");
+    }
+    Tcl_SetObjResult(interp, resultObj);
     return tohil_tcl_return(interp, prior, TCL_OK);
 }
 
@@ -1293,6 +3276,129 @@ TohilInteract_Cmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *
 
 /* Python library begins here */
 
+//
+// fastcall argument parsing
+//
+// tohil's python functions and methods are METH_FASTCALL, so they get
+// their arguments as a C array plus a tuple of keyword names instead
+// of a tuple and a dict.  each one describes its parameters once in a
+// static TohilArgSpec and tohil_parse_fastcall sorts the arguments it
+// was called with into a slot per parameter, borrowed references,
+// NULL for parameters that weren't given.
+//
+typedef struct {
+    const char *fname;         // function name, for error messages
+    const char *const *kwlist; // parameter names
+    int nparams;               // number of parameters
+    int npositional;           // how many of the leading ones can be positional
+    int nrequired;             // how many of the leading ones are required
+} TohilArgSpec;
+
+static int
+tohil_parse_fastcall(const TohilArgSpec *spec, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, PyObject **slots)
+{
+    int i;
+
+    if (nargs > spec->npositional) {
+        PyErr_Format(PyExc_TypeError, "%s() takes at most %d positional argument%s (%zd given)", spec->fname, spec->npositional,
+                     spec->npositional == 1 ? "" : "s", nargs);
+        return -1;
+    }
+
+    for (i = 0; i < nargs; i++)
+        slots[i] = args[i];
+    for (; i < spec->nparams; i++)
+        slots[i] = NULL;
+
+    if (kwnames != NULL) {
+        Py_ssize_t nkw = PyTuple_GET_SIZE(kwnames);
+        for (Py_ssize_t k = 0; k < nkw; k++) {
+            PyObject *kwname = PyTuple_GET_ITEM(kwnames, k);
+            for (i = 0; i < spec->nparams; i++) {
+                if (PyUnicode_CompareWithASCIIString(kwname, spec->kwlist[i]) == 0)
+                    break;
+            }
+            if (i == spec->nparams) {
+                PyErr_Format(PyExc_TypeError, "'%U' is an invalid keyword argument for %s()", kwname, spec->fname);
+                return -1;
+            }
+            if (slots[i] != NULL) {
+                PyErr_Format(PyExc_TypeError, "argument for %s() given by name ('%s') and position (%d)", spec->fname, spec->kwlist[i], i + 1);
+                return -1;
+            }
+            slots[i] = args[nargs + k];
+        }
+    }
+
+    for (i = 0; i < spec->nrequired; i++) {
+        if (slots[i] == NULL) {
+            PyErr_Format(PyExc_TypeError, "%s() missing required argument '%s' (pos %d)", spec->fname, spec->kwlist[i], i + 1);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+//
+// tohil_arg_string - get the utf-8 of a str argument, like "s" does for
+//   PyArg_ParseTuple, and optionally its length
+//
+static const char *
+tohil_arg_string(const TohilArgSpec *spec, PyObject *arg, Py_ssize_t *lengthPtr)
+{
+    Py_ssize_t length;
+
+    if (!PyUnicode_Check(arg)) {
+        PyErr_Format(PyExc_TypeError, "%s() argument must be str, not %.50s", spec->fname, Py_TYPE(arg)->tp_name);
+        return NULL;
+    }
+
+    const char *utf8 = PyUnicode_AsUTF8AndSize(arg, &length);
+    if (utf8 == NULL)
+        return NULL;
+
+    if (strlen(utf8) != (size_t)length) {
+        PyErr_SetString(PyExc_ValueError, "embedded null character");
+        return NULL;
+    }
+
+    if (lengthPtr != NULL)
+        *lengthPtr = length;
+    return utf8;
+}
+
+//
+// tohil_arg_int - get a C int out of an int argument, like "i" does
+//
+static int
+tohil_arg_int(PyObject *arg, int *intPtr)
+{
+    long value = PyLong_AsLong(arg);
+    if (value == -1 && PyErr_Occurred())
+        return -1;
+
+    if (value > INT_MAX || value < INT_MIN) {
+        PyErr_SetString(PyExc_OverflowError, "signed integer is greater than maximum");
+        return -1;
+    }
+    *intPtr = (int)value;
+    return 0;
+}
+
+//
+// tohil_arg_long - get a C long out of an int argument, like "l" does
+//
+static int
+tohil_arg_long(PyObject *arg, long *longPtr)
+{
+    long value = PyLong_AsLong(arg);
+    if (value == -1 && PyErr_Occurred())
+        return -1;
+
+    *longPtr = value;
+    return 0;
+}
+
 //
 //
 // python tcl object "tclobj"
@@ -1308,6 +3414,15 @@ TohilTclObj_Check(PyObject *pyObj)
     return PyObject_TypeCheck(pyObj, &TohilTclObjType);
 }
 
+//
+// return true if python object is a frozentclobj type
+//
+static int
+TohilFrozenTclObj_Check(PyObject *pyObj)
+{
+    return PyObject_TypeCheck(pyObj, &TohilFrozenTclObjType);
+}
+
 //
 // create a new python tclobj object from a tclobj
 //
@@ -1319,8 +3434,35 @@ TohilTclObj_FromTclObj(Tcl_Interp *interp, Tcl_Obj *obj)
         self->interp = interp;
         self->tclobj = obj;
         self->to = NULL;
+        self->toKind = TOHIL_TO_TCLOBJ;
+        self->tclvar = NULL;
+        self->hash = -1;
+        Tcl_IncrRefCount(obj);
+    }
+    return (PyObject *)self;
+}
+
+//
+// create a new python frozentclobj object from a tclobj.  the hash
+//   is worked out now, which also makes sure the tcl object has its
+//   string rep, so hashing it later doesn't have to touch it.
+//
+static PyObject *
+TohilFrozenTclObj_FromTclObj(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    TohilTclObj *self = (TohilTclObj *)TohilFrozenTclObjType.tp_alloc(&TohilFrozenTclObjType, 0);
+    if (self != NULL) {
+        self->interp = interp;
+        self->tclobj = obj;
+        self->to = NULL;
+        self->toKind = TOHIL_TO_TCLOBJ;
         self->tclvar = NULL;
+        self->hash = -1;
         Tcl_IncrRefCount(obj);
+        if (PyObject_Hash((PyObject *)self) == -1) {
+            Py_DECREF(self);
+            return NULL;
+        }
     }
     return (PyObject *)self;
 }
@@ -1336,6 +3478,23 @@ tohil_dict_dump(PyObject *pt)
 }
 #endif
 
+//
+// tohil_sequence_tuple - return a new reference to a tuple of the items
+//   of a sequence or iterable, like PySequence_Fast, but a copy even of
+//   a list.  use it in place of PySequence_Fast when converting the
+//   items can run python code, like a __str__ or a to= callable, that
+//   could change the list and free the items out from under us.
+//
+static PyObject *
+tohil_sequence_tuple(PyObject *pObj, const char *message)
+{
+    if (!PySequence_Check(pObj) && Py_TYPE(pObj)->tp_iter == NULL) {
+        PyErr_SetString(PyExc_TypeError, message);
+        return NULL;
+    }
+    return PySequence_Tuple(pObj);
+}
+
 // return true if toType is (probably) valid, else false
 static int
 tohil_check_toType(PyObject *toType)
@@ -1383,6 +3542,7 @@ TohilTclObj_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
         self->interp = interp;
         self->tclvar = NULL;
         self->tclobj = NULL;
+        self->hash = -1;
 
         Tcl_Obj *newObj;
         // it's from or empty if it gets to here but
@@ -1400,6 +3560,10 @@ TohilTclObj_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
             if (pDefault != NULL) {
                 if (Tcl_ObjGetVar2(self->interp, self->tclvar, NULL, 0) == NULL) {
                     newObj = pyObjToTcl(self->interp, pDefault);
+                    if (newObj == NULL) {
+                        Py_DECREF(self);
+                        return NULL;
+                    }
                     TohilTclObj_stuff_var(self, newObj);
                 }
             }
@@ -1415,11 +3579,16 @@ TohilTclObj_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
             } else {
                 // there's a source=, use that for the new tclobj
                 newObj = pyObjToTcl(self->interp, pDefault);
+                if (newObj == NULL) {
+                    Py_DECREF(self);
+                    return NULL;
+                }
             }
             self->tclobj = newObj;
             Tcl_IncrRefCount(self->tclobj);
         }
         self->to = toType;
+        self->toKind = tohil_to_kind(toType);
         Py_XINCREF(toType);
     }
     return (PyObject *)self;
@@ -1435,6 +3604,8 @@ TohilTclObj_dealloc(TohilTclObj *self)
         Tcl_DecrRefCount(self->tclobj);
     if (self->tclvar != NULL)
         Tcl_DecrRefCount(self->tclvar);
+    if (self->readObj != NULL)
+        Tcl_DecrRefCount(self->readObj);
     Py_XDECREF(self->to);
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
@@ -1452,11 +3623,23 @@ TohilTclObj_init(TohilTclObj *self, PyObject *args, PyObject *kwds)
 // whether it's directly got a tclobj (normal) or tied to a tcl
 // variable (tclvar).  use this when you want to access the tclobj
 // but you aren't planning to mutate it
+//
+// while the tcl object's byte array is exported in place through the
+// buffer protocol, reads go to a copy, made the first time it's needed,
+// so using the value as a list or a number can't free the bytes that
+// a memoryview is looking at.
 static Tcl_Obj *
 TohilTclObj_objptr(TohilTclObj *self)
 {
     if (self->tclobj != NULL) {
         assert(self->tclvar == NULL);
+        if (self->pinnedExports > 0) {
+            if (self->readObj == NULL) {
+                self->readObj = Tcl_DuplicateObj(self->tclobj);
+                Tcl_IncrRefCount(self->readObj);
+            }
+            return self->readObj;
+        }
         return self->tclobj;
     }
 
@@ -1468,6 +3651,25 @@ TohilTclObj_objptr(TohilTclObj *self)
     return obj;
 }
 
+// every write to a tclobj comes through here first.  frozentclobjs
+// refuse all writes, and other tclobjs refuse them while their byte
+// array is exported through the buffer protocol, so a memoryview's
+// contents can't change out from under it.  returns -1 with an error
+// set if the write isn't allowed.
+static int
+TohilTclObj_check_writable(TohilTclObj *self)
+{
+    if (TohilFrozenTclObj_Check((PyObject *)self)) {
+        PyErr_Format(PyExc_TypeError, "'%.200s' object is immutable", Py_TYPE(self)->tp_name);
+        return -1;
+    }
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError, "cannot modify tclobj while it is exported as a buffer");
+        return -1;
+    }
+    return 0;
+}
+
 // get the tclobj pointer of a tohil tclobj object, regardless of
 // whether it's directly got a tclobj (normal) or tied to a tcl
 // variable (tclvar).  but in this case, we want to write, so if
@@ -1480,6 +3682,9 @@ TohilTclObj_objptr(TohilTclObj *self)
 static Tcl_Obj *
 TohilTclObj_objptr_for_write(TohilTclObj *self)
 {
+    if (TohilTclObj_check_writable(self) < 0)
+        return NULL;
+
     // if there's a direct tclobj pointer, duplicate it if it's
     // shared and return the pointer
     if (self->tclobj != NULL) {
@@ -1535,6 +3740,9 @@ TohilTclObj_possibly_stuff_var(TohilTclObj *self, Tcl_Obj *obj)
 static int
 TohilTclObj_stuff_objptr(TohilTclObj *self, Tcl_Obj *obj)
 {
+    if (TohilTclObj_check_writable(self) < 0)
+        return -1;
+
     if (self->tclobj != NULL) {
         assert(self->tclobj->refCount > 0);
         Tcl_DecrRefCount(self->tclobj);
@@ -1549,6 +3757,9 @@ TohilTclObj_stuff_objptr(TohilTclObj *self, Tcl_Obj *obj)
 static Tcl_Obj *
 TohilTclObj_writable_objptr(TohilTclObj *self)
 {
+    if (TohilTclObj_check_writable(self) < 0)
+        return NULL;
+
     if (self->tclobj != NULL) {
         // assert(self->tclobj->refCount > 0);
         if (Tcl_IsShared(self->tclobj)) {
@@ -1590,19 +3801,10 @@ TohilTclObj_str(TohilTclObj *self)
 {
     int tclStringSize;
     Tcl_Obj *tclobj = TohilTclObj_objptr(self);
-    if (tclobj == NULL)
-        return NULL;
-    char *tclString = Tcl_GetStringFromObj(tclobj, &tclStringSize);
-
-    int utf8len;
-    char *utf8string;
-    if (tohil_TclToUTF8(self->interp, tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    if (tclobj == NULL)
         return NULL;
-    }
-    PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-    ckfree(utf8string);
-    return pObj;
+    char *tclString = Tcl_GetStringFromObj(tclobj, &tclStringSize);
+    return tohil_TclStringToPyUnicode(self->interp, tclString, tclStringSize);
 }
 
 //
@@ -1611,21 +3813,63 @@ TohilTclObj_str(TohilTclObj *self)
 static PyObject *
 TohilTclObj_repr(TohilTclObj *self)
 {
-    Tcl_DString ds;
     Tcl_Obj *tclobj = TohilTclObj_objptr(self);
     if (tclobj == NULL)
         return NULL;
-    char *utf8string = tohil_TclObjToUTF8DString(self->interp, tclobj, &ds);
 
-    PyObject *stringRep = PyUnicode_FromFormat("%s", utf8string);
+    PyObject *stringRep = tohil_TclObjToPyUnicode(self->interp, tclobj);
+    if (stringRep == NULL)
+        return NULL;
     // char *format = PyUnicode_GET_LENGTH(stringRep) > 100 ? "<%s: %.100R...>" : "<%s: %.100R>";
     char *format = "<%s: %R>";
-    Tcl_DStringFree(&ds);
     PyObject *repr = PyUnicode_FromFormat(format, Py_TYPE(self)->tp_name, stringRep);
     Py_DECREF(stringRep);
     return repr;
 }
 
+//
+// hash() method for python frozentclobj type - hash the string rep,
+//   the same as python hashes the str of it.  frozentclobjs only
+//   compare equal to strs and other tclobjs, by string, so the hash
+//   agrees with equality.
+//
+//   an ascii string rep hashes straight from tcl's bytes, so no python
+//   str is made.  anything else goes by the hash of the equivalent str.
+//   a frozentclobj can't change, so the hash is kept.
+//
+static Py_hash_t
+TohilTclObj_hash(TohilTclObj *self)
+{
+    if (self->hash != -1)
+        return self->hash;
+
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return -1;
+
+    int length;
+    const unsigned char *string = (const unsigned char *)Tcl_GetStringFromObj(selfobj, &length);
+    int i;
+    for (i = 0; i < length && string[i] < 0x80; i++)
+        ;
+
+    Py_hash_t hash;
+    if (i == length) {
+        hash = tohil_HashBytes(string, length);
+    } else {
+        PyObject *pStr = tohil_TclObjToPyUnicode(self->interp, selfobj);
+        if (pStr == NULL)
+            return -1;
+        hash = PyObject_Hash(pStr);
+        Py_DECREF(pStr);
+        if (hash == -1)
+            return -1;
+    }
+
+    self->hash = hash;
+    return hash;
+}
+
 //
 // richcompare() method for python tclobj type
 //
@@ -1658,12 +3902,18 @@ TohilTclObj_richcompare(TohilTclObj *self, PyObject *other, int op)
         otherString = Tcl_GetString(otherobj);
     } else {
         otherobj = pyObjToTcl(self->interp, other);
+        if (otherobj == NULL)
+            return NULL;
+        Tcl_IncrRefCount(otherobj);
         otherString = Tcl_GetString(otherobj);
     }
 
     int cmp = strcmp(selfString, otherString);
     int res = 0;
 
+    if (!TohilTclObj_Check(other) && !TohilTclDict_Check(other))
+        Tcl_DecrRefCount(otherobj);
+
     switch (op) {
     case Py_LT:
         res = (cmp < 0);
@@ -1681,75 +3931,667 @@ TohilTclObj_richcompare(TohilTclObj *self, PyObject *other, int op)
         res = (cmp != 0);
         break;
 
-    case Py_GT:
-        res = (cmp > 0);
-        break;
+    case Py_GT:
+        res = (cmp > 0);
+        break;
+
+    case Py_GE:
+        res = (cmp >= 0);
+        break;
+
+    default:
+        assert(0 == 1);
+    }
+    PyObject *p = (res ? Py_True : Py_False);
+    Py_INCREF(p);
+    return p;
+}
+
+//
+// richcompare() method for python frozentclobj type - like tclobj's,
+//   but only against strs and other tclobjs, so that anything equal to
+//   a frozentclobj hashes the same as it does.  a tclobj compares to a
+//   number by the number's tcl string, but a number doesn't hash like
+//   that string, so against anything else we don't say.
+//
+static PyObject *
+TohilFrozenTclObj_richcompare(TohilTclObj *self, PyObject *other, int op)
+{
+    if (!PyUnicode_Check(other) && !TohilTclObj_Check(other) && !TohilTclDict_Check(other))
+        Py_RETURN_NOTIMPLEMENTED;
+    return TohilTclObj_richcompare(self, other, op);
+}
+
+//
+// tclobj.clear() - clear a tclobj or tcldict to an empty tcl object
+//
+static PyObject *
+TohilTclObj_clear(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    if (TohilTclObj_check_writable(self) < 0)
+        return NULL;
+
+    if (self->tclvar != NULL) {
+        Tcl_DecrRefCount(self->tclvar);
+        self->tclvar = NULL;
+    }
+
+    if (self->tclobj != NULL) {
+        Tcl_DecrRefCount(self->tclobj);
+    }
+
+    self->tclobj = Tcl_NewObj();
+    Py_XDECREF(self->to);
+    self->to = NULL;
+    self->toKind = TOHIL_TO_TCLOBJ;
+    Tcl_IncrRefCount(self->tclobj);
+    Py_RETURN_NONE;
+}
+
+//
+// tclobj.as_dict()
+//
+static PyObject *
+TohilTclObj_as_dict(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return NULL;
+    // return tclListObjToPyDictObject(self->interp, selfobj);
+    return tclListObjToPyDictTclObjects(self->interp, selfobj);
+}
+
+//
+// tclobj.as_byte_array()
+//
+static PyObject *
+TohilTclObj_as_byte_array(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    int size;
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return NULL;
+    unsigned char *byteArray = Tcl_GetByteArrayFromObj(selfobj, &size);
+    return PyByteArray_FromStringAndSize((const char *)byteArray, size);
+}
+
+//
+// tohil_get_array_int - get an integer from a tcl object to be packed
+//   into an array.  a negative value comes back in *signedPtr, anything
+//   else in *unsignedPtr, so all of 'q' and 'Q' can be reached.  values
+//   that don't fit in 64 bits raise OverflowError, and non-integers
+//   ValueError.
+//
+static int
+tohil_get_array_int(Tcl_Interp *interp, char typecode, Tcl_Obj *obj, int *negativePtr, Tcl_WideInt *signedPtr, unsigned long long *unsignedPtr)
+{
+    tohil_find_tcl_types();
+
+    // tcl will give a bignum of up to 64 bits as a wide int, wrapped
+    // around, so only believe it if it didn't turn out to be one
+    Tcl_WideInt wideValue;
+    if (Tcl_GetWideIntFromObj(NULL, obj, &wideValue) == TCL_OK && obj->typePtr != tclBignumType) {
+        *negativePtr = (wideValue < 0);
+        *signedPtr = wideValue;
+        *unsignedPtr = (unsigned long long)wideValue;
+        return 0;
+    }
+
+    mp_int big;
+    if (Tcl_GetBignumFromObj(interp, obj, &big) != TCL_OK) {
+        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return -1;
+    }
+
+    unsigned long long magnitude = 0;
+    int overflow = 0;
+    for (int i = big.used - 1; i >= 0 && !overflow; i--) {
+        if (magnitude >> (64 - MP_DIGIT_BIT)) {
+            overflow = 1;
+        } else {
+            magnitude = (magnitude << MP_DIGIT_BIT) | big.dp[i];
+        }
+    }
+    int negative = (big.sign == MP_NEG);
+    mp_clear(&big);
+
+    if (overflow || (negative && magnitude > (1ULL << 63))) {
+        PyErr_Format(PyExc_OverflowError, "%s is out of range for array typecode '%c'", Tcl_GetString(obj), typecode);
+        return -1;
+    }
+
+    *negativePtr = negative;
+    *signedPtr = negative ? (Tcl_WideInt)(0 - magnitude) : 0;
+    *unsignedPtr = magnitude;
+    return 0;
+}
+
+//
+// tohil_pack_array_element - store a tcl object in a packed array
+//   buffer as the C type that the array module typecode says.  ints
+//   and doubles come straight from tcl's internal reps.
+//
+#define TOHIL_PACK_INT(CTYPE, MINVAL, MAXVAL)                                                                              \
+    {                                                                                                                      \
+        int negative;                                                                                                      \
+        Tcl_WideInt signedValue;                                                                                           \
+        unsigned long long unsignedValue;                                                                                  \
+        if (tohil_get_array_int(interp, typecode, obj, &negative, &signedValue, &unsignedValue) < 0)                       \
+            return -1;                                                                                                     \
+        if (negative ? (signedValue < (Tcl_WideInt)(MINVAL)) : (unsignedValue > (MAXVAL))) {                               \
+            PyErr_Format(PyExc_OverflowError, "%s is out of range for array typecode '%c'", Tcl_GetString(obj), typecode); \
+            return -1;                                                                                                     \
+        }                                                                                                                  \
+        CTYPE value = negative ? (CTYPE)signedValue : (CTYPE)unsignedValue;                                                \
+        memcpy(buf, &value, sizeof(CTYPE));                                                                                \
+        return 0;                                                                                                          \
+    }
+
+static int
+tohil_pack_array_element(Tcl_Interp *interp, char typecode, Tcl_Obj *obj, char *buf)
+{
+    switch (typecode) {
+    case 'b':
+        TOHIL_PACK_INT(signed char, SCHAR_MIN, SCHAR_MAX)
+    case 'B':
+        TOHIL_PACK_INT(unsigned char, 0, UCHAR_MAX)
+    case 'h':
+        TOHIL_PACK_INT(short, SHRT_MIN, SHRT_MAX)
+    case 'H':
+        TOHIL_PACK_INT(unsigned short, 0, USHRT_MAX)
+    case 'i':
+        TOHIL_PACK_INT(int, INT_MIN, INT_MAX)
+    case 'I':
+        TOHIL_PACK_INT(unsigned int, 0, UINT_MAX)
+    case 'l':
+        TOHIL_PACK_INT(long, LONG_MIN, LONG_MAX)
+    case 'L':
+        TOHIL_PACK_INT(unsigned long, 0, ULONG_MAX)
+    case 'q':
+        TOHIL_PACK_INT(long long, LLONG_MIN, LLONG_MAX)
+    case 'Q':
+        TOHIL_PACK_INT(unsigned long long, 0, ULLONG_MAX)
+
+    case 'f':
+    case 'd': {
+        double doubleValue;
+        if (Tcl_GetDoubleFromObj(interp, obj, &doubleValue) == TCL_ERROR) {
+            PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
+            return -1;
+        }
+        if (typecode == 'f') {
+            float floatValue = (float)doubleValue;
+            memcpy(buf, &floatValue, sizeof(float));
+        } else {
+            memcpy(buf, &doubleValue, sizeof(double));
+        }
+        return 0;
+    }
+    }
+
+    assert(0);
+    return -1;
+}
+#undef TOHIL_PACK_INT
+
+//
+// tohil_array_itemsize - the size of an element of an array module
+//   array with the given typecode, or 0 if we don't support it
+//
+static size_t
+tohil_array_itemsize(char typecode)
+{
+    switch (typecode) {
+    case 'b':
+    case 'B':
+        return sizeof(char);
+    case 'h':
+    case 'H':
+        return sizeof(short);
+    case 'i':
+    case 'I':
+        return sizeof(int);
+    case 'l':
+    case 'L':
+        return sizeof(long);
+    case 'q':
+    case 'Q':
+        return sizeof(long long);
+    case 'f':
+        return sizeof(float);
+    case 'd':
+        return sizeof(double);
+    }
+    return 0;
+}
+
+//
+// tohil_new_array - make an array.array of count zeroed elements of the
+//   given typecode, allocated once at its final size, and get a
+//   writable buffer onto its contents to pack the real elements into.
+//   the caller must release the buffer when it's done packing.
+//
+static PyObject *
+tohil_new_array(char typecode, Py_ssize_t count, Py_buffer *view)
+{
+    PyObject *arrayModule = PyImport_ImportModule("array");
+    if (arrayModule == NULL)
+        return NULL;
+
+    // one element repeated count times is allocated at its full size
+    // in one go, where initializing from a sequence would grow it
+    PyObject *pOne = PyObject_CallMethod(arrayModule, "array", "C(i)", typecode, 0);
+    Py_DECREF(arrayModule);
+    if (pOne == NULL)
+        return NULL;
+    PyObject *pArray = PySequence_Repeat(pOne, count);
+    Py_DECREF(pOne);
+    if (pArray == NULL)
+        return NULL;
+
+    if (PyObject_GetBuffer(pArray, view, PyBUF_WRITABLE) < 0) {
+        Py_DECREF(pArray);
+        return NULL;
+    }
+    return pArray;
+}
+
+//
+// tclobj.to_array(typecode='d') - return the tclobj, which must be a
+//   list of numbers, as an array.array of the given typecode.  the
+//   numbers are packed in one pass in C, without making a python
+//   object for each, and the array supports the buffer protocol, so
+//   numpy.frombuffer and memoryview can use it without copying.
+//
+static PyObject *
+TohilTclObj_to_array(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"typecode"};
+    static const TohilArgSpec spec = {"to_array", kwlist, 1, 1, 0};
+    PyObject *slots[1];
+    const char *typecode = "d";
+    Tcl_Obj **list;
+    int count;
+
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    if (slots[0] != NULL) {
+        if (!PyUnicode_Check(slots[0])) {
+            PyErr_Format(PyExc_TypeError, "to_array() typecode must be str, not %.200s", Py_TYPE(slots[0])->tp_name);
+            return NULL;
+        }
+        typecode = PyUnicode_AsUTF8(slots[0]);
+        if (typecode == NULL)
+            return NULL;
+    }
+
+    size_t itemsize = (strlen(typecode) == 1) ? tohil_array_itemsize(typecode[0]) : 0;
+    if (itemsize == 0) {
+        PyErr_SetString(PyExc_ValueError, "to_array() typecode must be one of b, B, h, H, i, I, l, L, q, Q, f or d");
+        return NULL;
+    }
+
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return NULL;
+
+    if (Tcl_ListObjGetElements(self->interp, selfobj, &count, &list) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    // pack everything straight into the array's own memory
+    Py_buffer view;
+    PyObject *pArray = tohil_new_array(typecode[0], count, &view);
+    if (pArray == NULL)
+        return NULL;
+
+    char *buf = (char *)view.buf;
+    for (int i = 0; i < count; i++, buf += itemsize) {
+        if (tohil_pack_array_element(self->interp, typecode[0], list[i], buf) < 0) {
+            PyBuffer_Release(&view);
+            Py_DECREF(pArray);
+            return NULL;
+        }
+    }
+
+    PyBuffer_Release(&view);
+    return pArray;
+}
+
+//
+// one column being gathered by tclobj.to_columns
+//
+typedef struct {
+    Tcl_Obj *keyObj;        // the field name, with a reference
+    PyObject *pName;        // the field name, as the result's key
+    char typecode;          // an array.array typecode, or 0 for a list
+    size_t itemsize;        // size of a packed element, for arrays
+    PyObject *toType;       // the to= type, with a reference, for lists
+    TohilToSpec spec;       // toType compiled, if toType isn't NULL
+    PyObject *pColumn;      // the list, or the array being packed
+    Py_buffer view;         // the array's memory, if view.obj isn't NULL
+} TohilColumn;
+
+//
+// tohil_column_set_type - set how a column's values are converted, from
+//   a to= type or, if it's a str, an array.array typecode.  NULL means str.
+//   the type is compiled once here, rather than for every value.
+//
+static int
+tohil_column_set_type(TohilColumn *column, PyObject *type)
+{
+    if (type == NULL)
+        type = (PyObject *)&PyUnicode_Type;
+
+    if (PyUnicode_Check(type)) {
+        const char *typecode = PyUnicode_AsUTF8(type);
+        if (typecode == NULL)
+            return -1;
+        column->itemsize = (strlen(typecode) == 1) ? tohil_array_itemsize(typecode[0]) : 0;
+        if (column->itemsize == 0) {
+            PyErr_SetString(PyExc_ValueError, "to_columns() typecode must be one of b, B, h, H, i, I, l, L, q, Q, f or d");
+            return -1;
+        }
+        column->typecode = typecode[0];
+        return 0;
+    }
+
+    if (!tohil_check_toType(type) || tohil_to_spec_compile(type, &column->spec) < 0)
+        return -1;
+    Py_INCREF(type);
+    column->toType = type;
+    return 0;
+}
+
+//
+// tclobj.to_columns(fields=None, types=None) - turn a tclobj containing
+//   a list of dicts, i.e. rows, into a dict of columns, mapping each
+//   field name to a list of that field's values, in one pass over the
+//   list and without making a python object for each row.
+//
+//   fields is a list of the field names to gather, by default the keys
+//   of the first row.  values are converted to str unless types says
+//   otherwise, either a dict of types by field name or one type for all
+//   of them.  a type is anything to= accepts, or an array.array typecode,
+//   which packs that column into an array.array.
+//
+//   a field missing from a row is None in a list column, and an error
+//   in an array column.
+//
+//   a to= callable can run code that changes the tclobj or uses the
+//   rows as something other than a list and dicts, so we work from
+//   a private copy of the list, hold each value while converting it,
+//   and look every value up again in its row.
+//
+static PyObject *
+TohilTclObj_to_columns(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"fields", "types"};
+    static const TohilArgSpec spec = {"to_columns", kwlist, 2, 2, 0};
+    PyObject *slots[2];
+    Tcl_Interp *interp = self->interp;
+    Tcl_Obj *rowsObj;
+    Tcl_Obj **rows;
+    int nrows;
+    Py_ssize_t ncolumns = 0;
+    TohilColumn *columns = NULL;
+    PyObject *pFields = NULL;
+    PyObject *pResult = NULL;
+
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+    PyObject *fields = (slots[0] == Py_None) ? NULL : slots[0];
+    PyObject *types = (slots[1] == Py_None) ? NULL : slots[1];
+
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return NULL;
+
+    // duplicating a list shares its elements without copying them
+    rowsObj = Tcl_DuplicateObj(selfobj);
+    Tcl_IncrRefCount(rowsObj);
+    if (Tcl_ListObjGetElements(interp, rowsObj, &nrows, &rows) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        Tcl_DecrRefCount(rowsObj);
+        return NULL;
+    }
+
+    if (fields != NULL) {
+        pFields = PySequence_Fast(fields, "to_columns() fields must be a sequence of field names");
+        if (pFields == NULL)
+            goto done;
+        ncolumns = PySequence_Fast_GET_SIZE(pFields);
+    } else if (nrows > 0) {
+        // default to the first row's fields, in its order
+        int size;
+        if (Tcl_DictObjSize(interp, rows[0], &size) == TCL_ERROR) {
+            PyErr_Format(PyExc_TypeError, "to_columns() row 0: %s", Tcl_GetString(Tcl_GetObjResult(interp)));
+            goto done;
+        }
+        ncolumns = size;
+    }
+
+    columns = (TohilColumn *)PyMem_Calloc(ncolumns > 0 ? ncolumns : 1, sizeof(TohilColumn));
+    if (columns == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    // work out the columns' names
+    if (pFields != NULL) {
+        for (Py_ssize_t c = 0; c < ncolumns; c++) {
+            PyObject *pName = PySequence_Fast_GET_ITEM(pFields, c);
+            if (!PyUnicode_Check(pName)) {
+                PyErr_Format(PyExc_TypeError, "to_columns() field names must be str, not %.200s", Py_TYPE(pName)->tp_name);
+                goto done;
+            }
+            columns[c].keyObj = tohil_PyUnicodeToTclObj(interp, pName);
+            if (columns[c].keyObj == NULL)
+                goto done;
+            Tcl_IncrRefCount(columns[c].keyObj);
+            Py_INCREF(pName);
+            columns[c].pName = pName;
+        }
+    } else if (ncolumns > 0) {
+        Tcl_DictSearch search;
+        Tcl_Obj *keyObj;
+        int done;
+        Py_ssize_t c = 0;
+
+        Tcl_DictObjFirst(NULL, rows[0], &search, &keyObj, NULL, &done);
+        for (; !done && c < ncolumns; c++, Tcl_DictObjNext(&search, &keyObj, NULL, &done)) {
+            columns[c].keyObj = keyObj;
+            Tcl_IncrRefCount(keyObj);
+            columns[c].pName = tohil_TclObjToPyKey(interp, keyObj);
+            if (columns[c].pName == NULL) {
+                Tcl_DictObjDone(&search);
+                goto done;
+            }
+        }
+        Tcl_DictObjDone(&search);
+    }
+
+    // work out the columns' types and make their lists or buffers
+    for (Py_ssize_t c = 0; c < ncolumns; c++) {
+        PyObject *type = types;
+        if (types != NULL && PyDict_Check(types)) {
+            type = PyDict_GetItemWithError(types, columns[c].pName);
+            if (type == NULL && PyErr_Occurred())
+                goto done;
+        }
+        if (tohil_column_set_type(&columns[c], type) < 0)
+            goto done;
+
+        if (columns[c].typecode) {
+            columns[c].pColumn = tohil_new_array(columns[c].typecode, nrows, &columns[c].view);
+        } else {
+            columns[c].pColumn = PyList_New(nrows);
+        }
+        if (columns[c].pColumn == NULL)
+            goto done;
+    }
+
+    // the one pass over the rows
+    for (int r = 0; r < nrows; r++) {
+        for (Py_ssize_t c = 0; c < ncolumns; c++) {
+            TohilColumn *column = &columns[c];
+            Tcl_Obj *valueObj;
+
+            if (Tcl_DictObjGet(interp, rows[r], column->keyObj, &valueObj) == TCL_ERROR) {
+                PyErr_Format(PyExc_TypeError, "to_columns() row %d: %s", r, Tcl_GetString(Tcl_GetObjResult(interp)));
+                goto done;
+            }
+
+            if (column->typecode) {
+                if (valueObj == NULL) {
+                    PyErr_Format(PyExc_ValueError, "to_columns() row %d has no field %R", r, column->pName);
+                    goto done;
+                }
+                if (tohil_pack_array_element(interp, column->typecode, valueObj, (char *)column->view.buf + column->itemsize * r) < 0)
+                    goto done;
+                continue;
+            }
+
+            PyObject *pValue;
+            if (valueObj == NULL) {
+                Py_INCREF(Py_None);
+                pValue = Py_None;
+            } else {
+                // the row holds the value only for as long as it stays a dict
+                Tcl_IncrRefCount(valueObj);
+                pValue = tohil_to_spec_convert(interp, &column->spec, valueObj);
+                Tcl_DecrRefCount(valueObj);
+                if (pValue == NULL)
+                    goto done;
+            }
+            PyList_SET_ITEM(column->pColumn, r, pValue);
+        }
+    }
+
+    // gather the columns into the result
+    pResult = PyDict_New();
+    if (pResult == NULL)
+        goto done;
 
-    case Py_GE:
-        res = (cmp >= 0);
-        break;
+    for (Py_ssize_t c = 0; c < ncolumns; c++) {
+        if (PyDict_SetItem(pResult, columns[c].pName, columns[c].pColumn) < 0) {
+            Py_CLEAR(pResult);
+            goto done;
+        }
+    }
 
-    default:
-        assert(0 == 1);
+done:
+    for (Py_ssize_t c = 0; columns != NULL && c < ncolumns; c++) {
+        if (columns[c].keyObj != NULL)
+            Tcl_DecrRefCount(columns[c].keyObj);
+        if (columns[c].view.obj != NULL)
+            PyBuffer_Release(&columns[c].view);
+        if (columns[c].toType != NULL) {
+            tohil_to_spec_free(&columns[c].spec);
+            Py_DECREF(columns[c].toType);
+        }
+        Py_XDECREF(columns[c].pName);
+        Py_XDECREF(columns[c].pColumn);
     }
-    PyObject *p = (res ? Py_True : Py_False);
-    Py_INCREF(p);
-    return p;
+    PyMem_Free(columns);
+    Py_XDECREF(pFields);
+    Tcl_DecrRefCount(rowsObj);
+    return pResult;
 }
 
 //
-// tclobj.clear() - clear a tclobj or tcldict to an empty tcl object
+// buffer protocol for python tclobj type - export the tcl object's
+//   byte array, read-only, so memoryview(), bytes(), hashlib, zlib and
+//   friends can read it.
 //
-static PyObject *
-TohilTclObj_clear(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+//   holding a reference to a Tcl_Obj doesn't stop it being converted
+//   to another type, which frees its byte array, so the view has to
+//   look at bytes that nothing else can convert.  if only the tclobj
+//   and its views hold the object, it's exported in place, without a
+//   copy, and the tclobj reads from a copy of its own until the views
+//   are released; see TohilTclObj_objptr.  otherwise, say when it's
+//   bound to a variable or shares its object with tcl, the view gets
+//   a private copy of the bytes.
+//
+//   either way, writes through the tclobj are refused until every
+//   export has been released.
+//
+static int
+TohilTclObj_getbuffer(TohilTclObj *self, Py_buffer *view, int flags)
 {
-    if (self->tclvar != NULL) {
-        Tcl_DecrRefCount(self->tclvar);
-        self->tclvar = NULL;
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "tclobj buffers are read-only");
+        view->obj = NULL;
+        return -1;
     }
 
-    if (self->tclobj != NULL) {
-        Tcl_DecrRefCount(self->tclobj);
+    Tcl_Obj *exportObj = self->tclobj;
+    int inPlace = (exportObj != NULL && exportObj->refCount == 1 + self->pinnedExports);
+    if (!inPlace) {
+        Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+        if (selfobj == NULL) {
+            view->obj = NULL;
+            return -1;
+        }
+        int size;
+        unsigned char *bytes = Tcl_GetByteArrayFromObj(selfobj, &size);
+        exportObj = Tcl_NewByteArrayObj(bytes, size);
     }
 
-    self->tclobj = Tcl_NewObj();
-    Py_XDECREF(self->to);
-    self->to = NULL;
-    Tcl_IncrRefCount(self->tclobj);
-    Py_RETURN_NONE;
+    int size;
+    unsigned char *bytes = Tcl_GetByteArrayFromObj(exportObj, &size);
+    Tcl_IncrRefCount(exportObj);
+
+    if (PyBuffer_FillInfo(view, (PyObject *)self, bytes, size, 1, flags) < 0) {
+        Tcl_DecrRefCount(exportObj);
+        return -1;
+    }
+
+    view->internal = exportObj;
+    self->exports++;
+    if (inPlace)
+        self->pinnedExports++;
+    return 0;
 }
 
-//
-// tclobj.as_dict()
-//
-static PyObject *
-TohilTclObj_as_dict(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+static void
+TohilTclObj_releasebuffer(TohilTclObj *self, Py_buffer *view)
 {
-    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
-    if (selfobj == NULL)
-        return NULL;
-    // return tclListObjToPyDictObject(self->interp, selfobj);
-    return tclListObjToPyDictTclObjects(self->interp, selfobj);
+    Tcl_Obj *exportObj = (Tcl_Obj *)view->internal;
+
+    // writes are refused while exported, so tclobj is still what it was
+    if (exportObj == self->tclobj && --self->pinnedExports == 0 && self->readObj != NULL) {
+        Tcl_DecrRefCount(self->readObj);
+        self->readObj = NULL;
+    }
+    Tcl_DecrRefCount(exportObj);
+    self->exports--;
 }
 
 //
-// tclobj.as_byte_array()
+// tclobj.__bytes__() - bytes(t) would otherwise try the tclobj as
+//   an integer size before ever looking at the buffer
 //
 static PyObject *
-TohilTclObj_as_byte_array(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+TohilTclObj_bytes(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
 {
-    int size;
     Tcl_Obj *selfobj = TohilTclObj_objptr(self);
     if (selfobj == NULL)
         return NULL;
-    unsigned char *byteArray = Tcl_GetByteArrayFromObj(selfobj, &size);
-    return PyByteArray_FromStringAndSize((const char *)byteArray, size);
+
+    int size;
+    unsigned char *bytes = Tcl_GetByteArrayFromObj(selfobj, &size);
+    return PyBytes_FromStringAndSize((const char *)bytes, size);
 }
 
 static void
 TohilTclObj_dup_if_shared(TohilTclObj *self)
 {
-    if (!Tcl_IsShared(self->tclobj)) {
+    // a tclobj bound to a tcl variable has no object of its own, and
+    // one with buffer exports is about to have its write refused
+    if (self->tclobj == NULL || self->exports > 0 || !Tcl_IsShared(self->tclobj)) {
         return;
     }
 
@@ -1765,15 +4607,19 @@ TohilTclObj_dup_if_shared(TohilTclObj *self)
 // tclobj.incr() - increment a python tclobj object
 //
 static PyObject *
-TohilTclObj_incr(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclObj_incr(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"incr", NULL};
+    static const char *const kwlist[] = {"incr"};
+    static const TohilArgSpec spec = {"incr", kwlist, 1, 1, 0};
+    PyObject *slots[1];
     Tcl_WideInt wideValue = 0;
     long increment = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|l", kwlist, &increment)) {
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    if (slots[0] != NULL && tohil_arg_long(slots[0], &increment) < 0)
         return NULL;
-    }
 
     Tcl_Obj *selfobj = TohilTclObj_objptr(self);
     if (selfobj == NULL)
@@ -1798,15 +4644,31 @@ TohilTclObj_incr(TohilTclObj *self, PyObject *args, PyObject *kwargs)
     return PyLong_FromLongLong(wideValue);
 }
 
+//
+// teardown an objv created by pyListToObjv
+//
+static void
+pyListToObjv_teardown(int objc, Tcl_Obj **objv)
+{
+    int i;
+
+    // tear down the objv of the keys we created
+    for (i = 0; i < objc; i++) {
+        Tcl_DecrRefCount(objv[i]);
+    }
+    ckfree(objv);
+}
+
 //
 // convert a python list into a tcl c-level objv and objc
 //
 // pyListToTclObjv(interp, pList, &objc, &objv);
 //
 // you must call pyListToObjv_teardown when done or you'll
-// leak memory
+// leak memory.  returns -1 with a python exception set, and
+// nothing to tear down, if an element can't be converted.
 //
-static void
+static int
 pyListToTclObjv(Tcl_Interp *interp, PyListObject *pList, int *intPtr, Tcl_Obj ***objvPtr)
 {
     int i;
@@ -1817,25 +4679,15 @@ pyListToTclObjv(Tcl_Interp *interp, PyListObject *pList, int *intPtr, Tcl_Obj **
     Tcl_Obj **objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
     for (i = 0; i < objc; i++) {
         objv[i] = pyObjToTcl(interp, PyList_GET_ITEM(pList, i));
+        if (objv[i] == NULL) {
+            pyListToObjv_teardown(i, objv);
+            return -1;
+        }
         Tcl_IncrRefCount(objv[i]);
     }
     *objvPtr = objv;
     *intPtr = objc;
-}
-
-//
-// teardown an objv created by pyListToObjv
-//
-static void
-pyListToObjv_teardown(int objc, Tcl_Obj **objv)
-{
-    int i;
-
-    // tear down the objv of the keys we created
-    for (i = 0; i < objc; i++) {
-        Tcl_DecrRefCount(objv[i]);
-    }
-    ckfree(objv);
+    return 0;
 }
 
 //
@@ -1899,15 +4751,20 @@ TohilTclObj_set(TohilTclObj *self, PyObject *pyObject)
 // to=type can be used to control what python type is returned.
 //
 static PyObject *
-TohilTclObj_lindex(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclObj_lindex(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"index", "to", NULL};
-    PyObject *to = NULL;
+    static const char *const kwlist[] = {"index", "to"};
+    static const TohilArgSpec spec = {"lindex", kwlist, 2, 1, 1};
+    PyObject *slots[2];
     int index = 0;
     int length = 0;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i|$O", kwlist, &index, &to))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    if (tohil_arg_int(slots[0], &index) < 0)
         return NULL;
+    PyObject *to = slots[1];
 
     Tcl_Obj *selfobj = TohilTclObj_objptr(self);
     if (selfobj == NULL)
@@ -1999,7 +4856,8 @@ TohilTclObj_lappend_list(TohilTclObj *self, PyObject *pObject)
         int objc;
         Tcl_Obj **objv = NULL;
 
-        pyListToTclObjv(self->interp, (PyListObject *)pObject, &objc, &objv);
+        if (pyListToTclObjv(self->interp, (PyListObject *)pObject, &objc, &objv) < 0)
+            return NULL;
         Tcl_Obj *appendListObj = Tcl_NewListObj(objc, objv);
         pyListToObjv_teardown(objc, objv);
 
@@ -2069,15 +4927,20 @@ TohilTclObj_type(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
 // location, like l.insert(0, "string")
 //
 static PyObject *
-TohilTclObj_insert(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclObj_insert(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"i", "x", NULL};
+    static const char *const kwlist[] = {"i", "x"};
+    static const TohilArgSpec spec = {"insert", kwlist, 2, 2, 2};
+    PyObject *slots[2];
     int index = 0;
-    PyObject *pyInsertObj = NULL;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "iO", kwlist, &index, &pyInsertObj))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
 
+    if (tohil_arg_int(slots[0], &index) < 0)
+        return NULL;
+    PyObject *pyInsertObj = slots[1];
+
     Tcl_Obj *newObj = pyObjToTcl(self->interp, pyInsertObj);
     if (newObj == NULL) {
         return NULL;
@@ -2107,15 +4970,19 @@ TohilTclObj_insert(TohilTclObj *self, PyObject *args, PyObject *kwargs)
 //
 //
 static PyObject *
-TohilTclObj_pop(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclObj_pop(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"i", "to", NULL};
+    static const char *const kwlist[] = {"i", "to"};
+    static const TohilArgSpec spec = {"pop", kwlist, 2, 1, 0};
+    PyObject *slots[2];
     int i = -999;
-    PyObject *to = NULL;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|i$O", kwlist, &i, &to)) {
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
-    }
+
+    if (slots[0] != NULL && tohil_arg_int(slots[0], &i) < 0)
+        return NULL;
+    PyObject *to = slots[1];
 
     Tcl_Obj *selfobj = TohilTclObj_objptr_for_write(self);
     if (selfobj == NULL)
@@ -2208,7 +5075,7 @@ TohilTclObj_slice(TohilTclObj *self, Py_ssize_t ilow, Py_ssize_t ihigh)
     for (i = 0; i < len; i++) {
         // create a new tclobj object and store
         // it into the python list we are making
-        PyObject *v = tohil_python_return(self->interp, TCL_OK, self->to, src[i]);
+        PyObject *v = tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, src[i]);
         PyList_SET_ITEM(np, i, v);
     }
     return (PyObject *)np;
@@ -2245,7 +5112,7 @@ TohilTclObj_item(TohilTclObj *self, Py_ssize_t i)
         return NULL;
     }
 
-    PyObject *ret = tohil_python_return(self->interp, TCL_OK, self->to, listObjv[i]);
+    PyObject *ret = tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, listObjv[i]);
     Py_INCREF(ret);
     return ret;
 }
@@ -2340,19 +5207,23 @@ TohilTclObj_concat(TohilTclObj *self, PyObject *item)
     if (TohilTclObj_Check(item)) {
         tItem = TohilTclObj_objptr((TohilTclObj *)item);
     } else {
-        tItem = _pyObjToTcl(self->interp, item);
-        if (tItem == NULL)
-            Py_RETURN_NOTIMPLEMENTED;
+        tItem = pyObjToTcl(self->interp, item);
     }
+    if (tItem == NULL)
+        return NULL;
+    Tcl_IncrRefCount(tItem);
 
     Tcl_Obj *selfobj = TohilTclObj_objptr(self);
-    if (selfobj == NULL)
+    if (selfobj == NULL) {
+        Tcl_DecrRefCount(tItem);
         return NULL;
+    }
 
     Tcl_Obj *returnObj = Tcl_DuplicateObj(selfobj);
+    Tcl_IncrRefCount(returnObj);
     Tcl_AppendObjToObj(returnObj, tItem);
-    Tcl_DString ds;
-    PyObject *pRet = Py_BuildValue("s", tohil_TclObjToUTF8DString(self->interp, returnObj, &ds));
+    Tcl_DecrRefCount(tItem);
+    PyObject *pRet = tohil_TclObjToPyUnicode(self->interp, returnObj);
     Tcl_DecrRefCount(returnObj);
     return pRet;
 }
@@ -2370,19 +5241,21 @@ TohilTclObj_inplace_concat(TohilTclObj *self, PyObject *item)
     Tcl_Obj *tItem = NULL;
     if (TohilTclObj_Check(item)) {
         tItem = TohilTclObj_objptr((TohilTclObj *)item);
-        if (tItem == NULL)
-            return NULL;
     } else {
-        tItem = _pyObjToTcl(self->interp, item);
-        if (tItem == NULL)
-            Py_RETURN_NOTIMPLEMENTED;
+        tItem = pyObjToTcl(self->interp, item);
     }
+    if (tItem == NULL)
+        return NULL;
+    Tcl_IncrRefCount(tItem);
 
     Tcl_Obj *writeObj = TohilTclObj_objptr_for_write(self);
-    if (writeObj == NULL)
+    if (writeObj == NULL) {
+        Tcl_DecrRefCount(tItem);
         return NULL;
+    }
 
     Tcl_AppendObjToObj(writeObj, tItem);
+    Tcl_DecrRefCount(tItem);
 
     if (TohilTclObj_possibly_stuff_var(self, writeObj) < 0)
         return NULL;
@@ -2428,7 +5301,7 @@ TohilTclObj_subscript(TohilTclObj *self, PyObject *item)
             PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
             return NULL;
         }
-        return tohil_python_return(self->interp, TCL_OK, self->to, resultObj);
+        return tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, resultObj);
     } else if (PySlice_Check(item)) {
         Py_ssize_t start, stop, step, slicelength, i;
         size_t cur;
@@ -2442,7 +5315,7 @@ TohilTclObj_subscript(TohilTclObj *self, PyObject *item)
         slicelength = PySlice_AdjustIndices(size, &start, &stop, step);
 
         if (slicelength <= 0) {
-            return tohil_python_return(self->interp, TCL_OK, self->to, Tcl_NewObj());
+            return tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, Tcl_NewObj());
         } else if (step == 1) {
             return TohilTclObj_slice(self, start, stop);
         } else {
@@ -2459,7 +5332,7 @@ TohilTclObj_subscript(TohilTclObj *self, PyObject *item)
             }
 
             for (cur = start, i = 0; i < slicelength; cur += (size_t)step, i++) {
-                it = tohil_python_return(self->interp, TCL_OK, self->to, listObjv[cur]);
+                it = tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, listObjv[cur]);
                 PyList_SET_ITEM(result, i, it);
             }
             return result;
@@ -2477,6 +5350,7 @@ TohilTclObj_subscript(TohilTclObj *self, PyObject *item)
 typedef struct {
     PyObject_HEAD;
     TohilTclObj *tohilObj;
+    Tcl_Obj *heldObj; // the tcl object we hold a reference to, if any
     int i;
     int done;
 } TohilTclObj_IterObj;
@@ -2493,13 +5367,13 @@ TohilTclObjIter(TohilTclObj *self)
     TohilTclObj_IterObj *pIter = (TohilTclObj_IterObj *)PyObject_New(TohilTclObj_IterObj, &TohilTclObj_IterType);
 
     pIter->tohilObj = self;
-    if (self->tclobj != NULL) {
-        Tcl_IncrRefCount(self->tclobj);
+    pIter->heldObj = self->tclobj;
+    if (pIter->heldObj != NULL) {
+        Tcl_IncrRefCount(pIter->heldObj);
     }
     Py_INCREF(self);
     pIter->i = 0;
     pIter->done = 0;
-    Py_INCREF(pIter);
     return (PyObject *)pIter;
 }
 
@@ -2526,8 +5400,9 @@ TohilTclObj_iternext(TohilTclObj_IterObj *self)
         // the tcl object we've been iterating, if it exists.
         if (!self->done) {
             self->done = 1;
-            if (self->tohilObj->tclobj != NULL) {
-                Tcl_DecrRefCount(self->tohilObj->tclobj);
+            if (self->heldObj != NULL) {
+                Tcl_DecrRefCount(self->heldObj);
+                self->heldObj = NULL;
             }
         }
         PyErr_SetNone(PyExc_StopIteration);
@@ -2541,7 +5416,7 @@ TohilTclObj_iternext(TohilTclObj_IterObj *self)
     }
 
     self->i++;
-    return tohil_python_return(interp, TCL_OK, NULL, resultObj);
+    return tohil_python_return_kind(interp, TCL_OK, self->tohilObj->toKind, self->tohilObj->to, resultObj);
 }
 
 //
@@ -2551,8 +5426,8 @@ static void
 TohilTclObjIter_dealloc(TohilTclObj_IterObj *self)
 {
     // NB we need to do var shadowing with tcldicts too
-    if (self->tohilObj->tclobj != NULL) {
-        Tcl_DecrRefCount(self->tohilObj->tclobj);
+    if (self->heldObj != NULL) {
+        Tcl_DecrRefCount(self->heldObj);
     }
     Py_XDECREF(self->tohilObj);
     Py_TYPE(self)->tp_free((PyObject *)self);
@@ -2568,6 +5443,155 @@ static PyTypeObject TohilTclObj_IterType = {
     .tp_iternext = (iternextfunc)TohilTclObj_iternext,
 };
 
+//
+// tclobj chunk iterator type, for tclobj.iter_chunks
+//
+
+typedef struct {
+    PyObject_HEAD;
+    Tcl_Interp *interp;
+    Tcl_Obj *heldObj; // the list being chunked, with a reference, or NULL when done
+    int i;
+    int chunkSize;
+    enum TohilToKind toKind;
+    PyObject *to;
+} TohilTclObj_ChunkIterObj;
+
+//
+// tclobj chunk iterator's iternext - convert the next chunkSize
+//   elements of the list and return them as a python list.
+//
+//   we iterate over a private copy of the list as it was when the
+//   iterator was made, and drop it at the end, so only one chunk's
+//   worth of python objects need exist at a time.  nothing else can
+//   get at the copy, so a to= callable can't make it anything but a
+//   list, and its elements stay put while they're being converted.
+//
+static PyObject *
+TohilTclObj_chunk_iternext(TohilTclObj_ChunkIterObj *self)
+{
+    Tcl_Obj **objv;
+    int objc;
+
+    if (self->heldObj == NULL)
+        return NULL;
+
+    Tcl_ListObjGetElements(NULL, self->heldObj, &objc, &objv);
+
+    if (self->i >= objc) {
+        Tcl_DecrRefCount(self->heldObj);
+        self->heldObj = NULL;
+        return NULL;
+    }
+
+    int count = objc - self->i;
+    if (count > self->chunkSize)
+        count = self->chunkSize;
+
+    PyObject *pChunk = PyList_New(count);
+    if (pChunk == NULL)
+        return NULL;
+
+    for (int i = 0; i < count; i++) {
+        PyObject *pObj = tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, objv[self->i + i]);
+        if (pObj == NULL) {
+            Py_DECREF(pChunk);
+            return NULL;
+        }
+        PyList_SET_ITEM(pChunk, i, pObj);
+    }
+
+    self->i += count;
+    return pChunk;
+}
+
+//
+// deallocate function for python tclobj chunk iterators
+//
+static void
+TohilTclObj_ChunkIter_dealloc(TohilTclObj_ChunkIterObj *self)
+{
+    if (self->heldObj != NULL) {
+        Tcl_DecrRefCount(self->heldObj);
+    }
+    Py_XDECREF(self->to);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject TohilTclObj_ChunkIterType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil_tclobj_chunk_iter",
+    .tp_basicsize = sizeof(TohilTclObj_ChunkIterObj),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "tohil tclobj chunk iterator type",
+    .tp_dealloc = (destructor)TohilTclObj_ChunkIter_dealloc,
+    .tp_iter = (getiterfunc)PyObject_SelfIter,
+    .tp_iternext = (iternextfunc)TohilTclObj_chunk_iternext,
+};
+
+//
+// tclobj.iter_chunks(n, to=None) - return an iterator over the
+//   tclobj, which must be a list, that yields python lists of up to
+//   n elements at a time, converted per to, or the tclobj's own to
+//   if it isn't given.  huge lists can be streamed through without
+//   converting all of them into one python list at once.
+//
+static PyObject *
+TohilTclObj_iter_chunks(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"n", "to"};
+    static const TohilArgSpec spec = {"iter_chunks", kwlist, 2, 1, 1};
+    PyObject *slots[2];
+    int length;
+
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    Py_ssize_t n = PyNumber_AsSsize_t(slots[0], PyExc_OverflowError);
+    if (n == -1 && PyErr_Occurred())
+        return NULL;
+    if (n <= 0) {
+        PyErr_SetString(PyExc_ValueError, "iter_chunks() n must be greater than zero");
+        return NULL;
+    }
+    // a chunk can't be bigger than a tcl list anyway
+    int chunkSize = (n > INT_MAX) ? INT_MAX : (int)n;
+
+    PyObject *toType = self->to;
+    enum TohilToKind toKind = self->toKind;
+    if (slots[1] != NULL && slots[1] != Py_None) {
+        if (!tohil_check_toType(slots[1]))
+            return NULL;
+        toType = slots[1];
+        toKind = tohil_to_kind(toType);
+    }
+
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return NULL;
+
+    // make sure it's a list now rather than on the first next()
+    if (Tcl_ListObjLength(self->interp, selfobj, &length) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    TohilTclObj_ChunkIterObj *pIter = PyObject_New(TohilTclObj_ChunkIterObj, &TohilTclObj_ChunkIterType);
+    if (pIter == NULL)
+        return NULL;
+
+    // duplicating a list shares its elements without copying them,
+    // and tcl copies them before changing either list
+    pIter->interp = self->interp;
+    pIter->heldObj = Tcl_DuplicateObj(selfobj);
+    Tcl_IncrRefCount(pIter->heldObj);
+    pIter->i = 0;
+    pIter->chunkSize = chunkSize;
+    pIter->toKind = toKind;
+    pIter->to = toType;
+    Py_XINCREF(toType);
+    return (PyObject *)pIter;
+}
+
 //
 // end of python tcl object "tclobj"
 //
@@ -2584,6 +5608,7 @@ typedef struct {
     int started;
     int done;
     PyObject *to;
+    enum TohilToKind toKind;
     Tcl_Interp *interp;
     Tcl_Obj *dictObj;
     Tcl_DictSearch search;
@@ -2615,9 +5640,6 @@ Tohil_TD_multi_iternext(Tohil_TD_IterObj *self, enum td_itertype itertype)
     Tcl_Obj *valueObj = NULL;
     int done = 0;
 
-    int utf8len;
-    char *utf8string;
-
     if (self->done) {
     done:
         PyErr_SetNone(PyExc_StopIteration);
@@ -2646,51 +5668,39 @@ Tohil_TD_multi_iternext(Tohil_TD_IterObj *self, enum td_itertype itertype)
         goto done;
     }
 
-    if (itertype == Keys || itertype == Values || (itertype == Iter && self->to == NULL)) {
-        int tclStringSize;
-        char *tclString;
-
-        if (itertype != Values) {
-            tclString = Tcl_GetStringFromObj(keyObj, &tclStringSize);
-        } else {
-            tclString = Tcl_GetStringFromObj(valueObj, &tclStringSize);
-        }
+    if (itertype == Values) {
+        return tohil_TclObjToPyUnicode(self->interp, valueObj);
+    }
 
-        if (tohil_TclToUTF8(self->interp, tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-            return NULL;
-        }
-        PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-        ckfree(utf8string);
-        return pObj;
+    if (itertype == Keys || (itertype == Iter && self->to == NULL)) {
+        return tohil_TclObjToPyKey(self->interp, keyObj);
     }
 
     // they specified a to, return a tuple
-    PyObject *pRetTuple = PyTuple_New(2);
-
-    int tclStringSize;
-    char *tclString = Tcl_GetStringFromObj(keyObj, &tclStringSize);
-
-    if (tohil_TclToUTF8(self->interp, tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    PyObject *pKey = tohil_TclObjToPyKey(self->interp, keyObj);
+    if (pKey == NULL)
         return NULL;
-    }
-    PyTuple_SET_ITEM(pRetTuple, 0, Py_BuildValue("s#", utf8string, utf8len));
-    ckfree(utf8string);
 
+    PyObject *pValue;
     if (self->to == NULL) {
         // no "to" specified, stuff the value into item 1 of the tuple
-        tclString = Tcl_GetStringFromObj(valueObj, &tclStringSize);
-        if (tohil_TclToUTF8(self->interp, tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-            return NULL;
-        }
-        PyTuple_SET_ITEM(pRetTuple, 1, Py_BuildValue("s#", utf8string, utf8len));
-        ckfree(utf8string);
+        pValue = tohil_TclObjToPyUnicode(self->interp, valueObj);
     } else {
-        PyTuple_SET_ITEM(pRetTuple, 1, tohil_python_return(self->interp, TCL_OK, self->to, valueObj));
+        pValue = tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, valueObj);
+    }
+    if (pValue == NULL) {
+        Py_DECREF(pKey);
+        return NULL;
     }
 
+    PyObject *pRetTuple = PyTuple_New(2);
+    if (pRetTuple == NULL) {
+        Py_DECREF(pKey);
+        Py_DECREF(pValue);
+        return NULL;
+    }
+    PyTuple_SET_ITEM(pRetTuple, 0, pKey);
+    PyTuple_SET_ITEM(pRetTuple, 1, pValue);
     return pRetTuple;
 }
 
@@ -2827,14 +5837,13 @@ tclobj_nb_bool(TohilTclObj *self)
 static PyObject *
 tclobj_nb_long(PyObject *p)
 {
-    Tcl_WideInt wideValue = 0;
-
     TohilTclObj *self = (TohilTclObj *)p;
     Tcl_Obj *selfobj = TohilTclObj_objptr(self);
     if (selfobj == NULL)
         return NULL;
 
-    if (Tcl_GetWideIntFromObj(self->interp, selfobj, &wideValue) == TCL_ERROR) {
+    PyObject *pLong;
+    if (tohil_TclObjToPyLong(self->interp, selfobj, &pLong) == TCL_ERROR) {
         double doubleValue = 0;
         if (Tcl_GetDoubleFromObj(NULL, selfobj, &doubleValue) == TCL_OK) {
             return PyLong_FromDouble(doubleValue);
@@ -2842,7 +5851,7 @@ tclobj_nb_long(PyObject *p)
         PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
         return NULL;
     }
-    return PyLong_FromLongLong(wideValue);
+    return pLong;
 }
 
 static PyObject *
@@ -3235,6 +6244,8 @@ tclobj_nb_inplace_binop(PyObject *v, PyObject *w, enum tclobj_op operator)
     TohilTclObj *self = (TohilTclObj *)v;
 
     Tcl_Obj *writeObj = TohilTclObj_writable_objptr(self);
+    if (writeObj == NULL)
+        return NULL;
 
     if (vFloat || wFloat) {
         if (!wFloat) {
@@ -3486,11 +6497,17 @@ TohilTclObj_getto(TohilTclObj *self, void *closure)
 static int
 TohilTclObj_setto(TohilTclObj *self, PyObject *toType, void *closure)
 {
+    if (TohilFrozenTclObj_Check((PyObject *)self)) {
+        PyErr_Format(PyExc_AttributeError, "'%.200s' object's to is read-only", Py_TYPE(self)->tp_name);
+        return -1;
+    }
+
     if (!tohil_check_toType(toType))
         return -1;
 
     PyObject *tmp = self->to;
     self->to = toType;
+    self->toKind = tohil_to_kind(toType);
     Py_INCREF(toType);
     Py_XDECREF(tmp);
     return 0;
@@ -3503,6 +6520,8 @@ static PyGetSetDef TohilTclObj_getsetters[] = {
     {"_tcltype", (getter)TohilTclObj_type, NULL, "internal tcl data type of the tcl object", NULL},
     {NULL}};
 
+static PyBufferProcs TohilTclObj_as_buffer = {(getbufferproc)TohilTclObj_getbuffer, (releasebufferproc)TohilTclObj_releasebuffer};
+
 static PyMappingMethods TohilTclObj_as_mapping = {(lenfunc)TohilTclObj_length, (binaryfunc)TohilTclObj_subscript, NULL};
 
 static PySequenceMethods TohilTclObj_as_sequence = {
@@ -3523,15 +6542,22 @@ static PyMethodDef TohilTclObj_methods[] = {
     {"clear", (PyCFunction)TohilTclObj_clear, METH_NOARGS, "empty the tclobj"},
     {"as_dict", (PyCFunction)TohilTclObj_as_dict, METH_NOARGS, "return tclobj as dict"},
     {"as_byte_array", (PyCFunction)TohilTclObj_as_byte_array, METH_NOARGS, "return tclobj as a byte array"},
-    {"incr", (PyCFunction)TohilTclObj_incr, METH_VARARGS | METH_KEYWORDS, "increment tclobj as int"},
+    {"__bytes__", (PyCFunction)TohilTclObj_bytes, METH_NOARGS, "return tclobj's byte array as bytes"},
+    {"to_array", (PyCFunction)(void (*)(void))TohilTclObj_to_array, METH_FASTCALL | METH_KEYWORDS,
+     "return tclobj, a list of numbers, as an array.array of the given typecode"},
+    {"to_columns", (PyCFunction)(void (*)(void))TohilTclObj_to_columns, METH_FASTCALL | METH_KEYWORDS,
+     "return tclobj, a list of dicts, as a dict of columns"},
+    {"iter_chunks", (PyCFunction)(void (*)(void))TohilTclObj_iter_chunks, METH_FASTCALL | METH_KEYWORDS,
+     "return an iterator over tclobj, a list, yielding python lists of up to n elements"},
+    {"incr", (PyCFunction)(void (*)(void))TohilTclObj_incr, METH_FASTCALL | METH_KEYWORDS, "increment tclobj as int"},
     {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
     {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
     {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
-    {"lindex", (PyCFunction)TohilTclObj_lindex, METH_VARARGS | METH_KEYWORDS, "get value from tclobj as tcl list"},
+    {"lindex", (PyCFunction)(void (*)(void))TohilTclObj_lindex, METH_FASTCALL | METH_KEYWORDS, "get value from tclobj as tcl list"},
     {"append", (PyCFunction)TohilTclObj_lappend, METH_O, "lappend (list-append) something to tclobj"},
     {"extend", (PyCFunction)TohilTclObj_lappend_list, METH_O, "lappend another tclobj or a python list of stuff to tclobj"},
-    {"pop", (PyCFunction)TohilTclObj_pop, METH_VARARGS | METH_KEYWORDS, pop__doc__},
-    {"insert", (PyCFunction)TohilTclObj_insert, METH_VARARGS | METH_KEYWORDS, "Insert object before index."},
+    {"pop", (PyCFunction)(void (*)(void))TohilTclObj_pop, METH_FASTCALL | METH_KEYWORDS, pop__doc__},
+    {"insert", (PyCFunction)(void (*)(void))TohilTclObj_insert, METH_FASTCALL | METH_KEYWORDS, "Insert object before index."},
     {NULL} // sentinel
 };
 
@@ -3549,12 +6575,51 @@ static PyTypeObject TohilTclObjType = {
     .tp_iter = (getiterfunc)TohilTclObjIter,
     .tp_as_sequence = &TohilTclObj_as_sequence,
     .tp_as_mapping = &TohilTclObj_as_mapping,
+    .tp_as_buffer = &TohilTclObj_as_buffer,
     .tp_repr = (reprfunc)TohilTclObj_repr,
     .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
     .tp_getset = TohilTclObj_getsetters,
     .tp_as_number = &tclobj_as_number,
 };
 
+//
+// create a new python frozentclobj object, the same as a tclobj but
+//   it can't be tied to a tcl variable, since that could change it
+//
+static PyObject *
+TohilFrozenTclObj_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    if (kwargs != NULL && PyDict_GetItemString(kwargs, "var") != NULL) {
+        PyErr_SetString(PyExc_TypeError, "frozentclobj can't be bound to a tcl variable");
+        return NULL;
+    }
+
+    PyObject *self = TohilTclObj_new(type, args, kwargs);
+    if (self != NULL && PyObject_Hash(self) == -1) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return self;
+}
+
+//
+// frozentclobj - an immutable tclobj.  all of tclobj's methods that
+//   write to it raise TypeError, so its value and hash never change
+//   and it can safely be a dict key or set member.  tclobj itself
+//   stays unhashable, since it's mutable and equals numbers.
+//
+static PyTypeObject TohilFrozenTclObjType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.frozentclobj",
+    .tp_doc = "Immutable Tcl Object",
+    .tp_basicsize = sizeof(TohilTclObj),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_base = &TohilTclObjType,
+    .tp_new = TohilFrozenTclObj_new,
+    .tp_richcompare = (richcmpfunc)TohilFrozenTclObj_richcompare,
+    .tp_hash = (hashfunc)TohilTclObj_hash,
+};
+
 //
 // end of tclobj python datatype
 //
@@ -3622,6 +6687,9 @@ TohilTclDict_td_locate(TohilTclObj *self, PyObject *keys)
         for (i = 0; i < nKeys; i++) {
             PyObject *keyPyObj = PyList_GET_ITEM(keys, i);
             keyObj = pyObjToTcl(self->interp, keyPyObj);
+            if (keyObj == NULL)
+                return NULL;
+            Tcl_IncrRefCount(keyObj);
 
             if (Tcl_DictObjGet(self->interp, dictPtrObj, keyObj, &valueObj) == TCL_ERROR) {
                 Tcl_DecrRefCount(keyObj);
@@ -3640,6 +6708,9 @@ TohilTclDict_td_locate(TohilTclObj *self, PyObject *keys)
     } else {
         // it's a singleton
         Tcl_Obj *keyObj = pyObjToTcl(self->interp, keys);
+        if (keyObj == NULL)
+            return NULL;
+        Tcl_IncrRefCount(keyObj);
 
         if (Tcl_DictObjGet(NULL, selfobj, keyObj, &valueObj) == TCL_ERROR) {
             Tcl_DecrRefCount(keyObj);
@@ -3656,19 +6727,24 @@ TohilTclDict_td_locate(TohilTclObj *self, PyObject *keys)
 // td_get(key) - do a dict get on the tcl object
 //
 static PyObject *
-TohilTclDict_td_get(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclDict_td_get(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"key", "to", "default", NULL};
-    PyObject *keys = NULL;
-    PyObject *to = NULL;
-    PyObject *pDefault = NULL;
+    static const char *const kwlist[] = {"key", "to", "default"};
+    static const TohilArgSpec spec = {"get", kwlist, 3, 1, 1};
+    PyObject *slots[3];
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$OO", kwlist, &keys, &to, &pDefault)) {
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
-    }
+
+    PyObject *keys = slots[0];
+    PyObject *to = slots[1];
+    PyObject *pDefault = slots[2];
 
     Tcl_Obj *valueObj = TohilTclDict_td_locate(self, keys);
     if (valueObj == NULL) {
+        // the key couldn't be converted or the object isn't a dict
+        if (PyErr_Occurred())
+            return NULL;
         if (pDefault != NULL) {
             if (to == NULL) {
                 // not there but they provided a default,
@@ -3677,6 +6753,8 @@ TohilTclDict_td_get(TohilTclObj *self, PyObject *args, PyObject *kwargs)
                 return pDefault;
             } else {
                 valueObj = pyObjToTcl(self->interp, pDefault);
+                if (valueObj == NULL)
+                    return NULL;
             }
         } else {
             // not there, no default.  it's an error.
@@ -3705,13 +6783,16 @@ TohilTclDict_subscript(TohilTclObj *self, PyObject *keys)
     // printf("TohilTclDict_subscript\n");
     Tcl_Obj *valueObj = TohilTclDict_td_locate(self, keys);
     if (valueObj == NULL) {
+        // the key couldn't be converted or the object isn't a dict
+        if (PyErr_Occurred())
+            return NULL;
         // not there, no default.  it's an error.
         // this is clean and the way python does it.
         PyErr_SetObject(PyExc_KeyError, keys);
         return NULL;
     }
 
-    return tohil_python_return(self->interp, TCL_OK, self->to, valueObj);
+    return tohil_python_return_kind(self->interp, TCL_OK, self->toKind, self->to, valueObj);
 }
 
 //
@@ -3728,12 +6809,15 @@ TohilTclDict_delitem(TohilTclObj *self, PyObject *keys)
         Tcl_Obj **objv = NULL;
 
         // build up a tcl objv of the keys
-        pyListToTclObjv(self->interp, (PyListObject *)keys, &objc, &objv);
+        if (pyListToTclObjv(self->interp, (PyListObject *)keys, &objc, &objv) < 0)
+            return -1;
 
         // we are about to try to modify the object, so if it's shared we need to copy
         Tcl_Obj *writeObj = TohilTclObj_objptr_for_write(self);
-        if (writeObj == NULL)
+        if (writeObj == NULL) {
+            pyListToObjv_teardown(objc, objv);
             return -1;
+        }
 
         int status = (Tcl_DictObjRemoveKeyList(self->interp, writeObj, objc, objv));
 
@@ -3745,17 +6829,17 @@ TohilTclDict_delitem(TohilTclObj *self, PyObject *keys)
             return -1;
         }
     } else {
-        Tcl_Obj *keyObj = _pyObjToTcl(self->interp, keys);
-
-        if (keyObj == NULL) {
-            PyErr_SetString(PyExc_RuntimeError, "unable to fashion argument into a string to be used as a dictionary key");
+        Tcl_Obj *keyObj = pyObjToTcl(self->interp, keys);
+        if (keyObj == NULL)
             return -1;
-        }
+        Tcl_IncrRefCount(keyObj);
 
         // we are about to try to modify the object, so if it's shared we need to copy
         writeObj = TohilTclObj_writable_objptr(self);
-        if (writeObj == NULL)
+        if (writeObj == NULL) {
+            Tcl_DecrRefCount(keyObj);
             return -1;
+        }
 
         if (Tcl_DictObjRemove(NULL, writeObj, keyObj) == TCL_ERROR) {
             Tcl_DecrRefCount(keyObj);
@@ -3778,21 +6862,33 @@ TohilTclDict_delitem(TohilTclObj *self, PyObject *keys)
 static int
 TohilTclDict_setitem(TohilTclObj *self, PyObject *keys, PyObject *pValue)
 {
+    // the value and key objects might be new or might belong to
+    // something else, like another tclobj, so hold a reference to them
+    // while we work and let go of it on the way out.  the dict takes
+    // its own references to what it keeps.
     Tcl_Obj *valueObj = pyObjToTcl(self->interp, pValue);
+    if (valueObj == NULL)
+        return -1;
+    Tcl_IncrRefCount(valueObj);
 
     // we are about to try to modify the object, so if it's shared we need to copy
     TohilTclObj_dup_if_shared(self);
 
     Tcl_Obj *writeObj = TohilTclObj_objptr_for_write(self);
-    if (writeObj == NULL)
+    if (writeObj == NULL) {
+        Tcl_DecrRefCount(valueObj);
         return -1;
+    }
 
     if (PyList_Check(keys)) {
         int objc;
         Tcl_Obj **objv;
 
         // build up a tcl objv of the keys
-        pyListToTclObjv(self->interp, (PyListObject *)keys, &objc, &objv);
+        if (pyListToTclObjv(self->interp, (PyListObject *)keys, &objc, &objv) < 0) {
+            Tcl_DecrRefCount(valueObj);
+            return -1;
+        }
 
         int status = (Tcl_DictObjPutKeyList(self->interp, writeObj, objc, objv, valueObj));
 
@@ -3805,23 +6901,22 @@ TohilTclDict_setitem(TohilTclObj *self, PyObject *keys, PyObject *pValue)
             return -1;
         }
     } else {
-        Tcl_Obj *keyObj = _pyObjToTcl(self->interp, keys);
-
+        Tcl_Obj *keyObj = pyObjToTcl(self->interp, keys);
         if (keyObj == NULL) {
-            PyErr_SetString(PyExc_RuntimeError, "unable to fashion argument into a string to be used as a dictionary key");
+            Tcl_DecrRefCount(valueObj);
             return -1;
         }
+        Tcl_IncrRefCount(keyObj);
 
-        if (Tcl_DictObjPut(self->interp, writeObj, keyObj, valueObj) == TCL_ERROR) {
-            Tcl_DecrRefCount(keyObj);
+        int status = Tcl_DictObjPut(self->interp, writeObj, keyObj, valueObj);
+        Tcl_DecrRefCount(keyObj);
+        if (status == TCL_ERROR) {
             Tcl_DecrRefCount(valueObj);
             PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
             return -1;
         }
-        // something about this is a crash
-        // Tcl_DecrRefCount(keyObj);
-        // Tcl_DecrRefCount(valueObj);
     }
+    Tcl_DecrRefCount(valueObj);
 
     if (TohilTclObj_possibly_stuff_var(self, writeObj) < 0)
         return -1;
@@ -3834,18 +6929,17 @@ TohilTclDict_setitem(TohilTclObj *self, PyObject *keys, PyObject *pValue)
 //   of dictionaries.
 //
 static PyObject *
-TohilTclDict_td_set(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclDict_td_set(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"key", "value", NULL};
-    PyObject *keys = NULL;
-    PyObject *pValue = NULL;
+    static const char *const kwlist[] = {"key", "value"};
+    static const TohilArgSpec spec = {"td_set", kwlist, 2, 2, 2};
+    PyObject *slots[2];
 
-    // remember, "O" sets our pointer to the object without incrementing its reference count
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|$", kwlist, &keys, &pValue)) {
+    // remember, the slots are borrowed references
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
-    }
 
-    if (TohilTclDict_setitem(self, keys, pValue) < 0) {
+    if (TohilTclDict_setitem(self, slots[0], slots[1]) < 0) {
         return NULL;
     }
 
@@ -3891,158 +6985,603 @@ TohilTclDict_length(TohilTclObj *self)
 }
 
 //
-// TohilTclDict_size() - return a python object containing the dict size
-//   of a python tcldict's tcl object.
-//   returns null i.e. exception thrown if tcl object isn't a proper tcl dict.
+// TohilTclDict_size() - return a python object containing the dict size
+//   of a python tcldict's tcl object.
+//   returns null i.e. exception thrown if tcl object isn't a proper tcl dict.
+//
+static PyObject *
+TohilTclDict_size(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    int length = TohilTclDict_length(self);
+    if (length < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(length);
+}
+
+//
+// TohilTclDictIter_new() - returns a tcldict iterator object that can
+//   iterate over a tcldict.
+//
+static PyObject *
+TohilTclDictIter_new(TohilTclObj *self, PyTypeObject *itertype)
+{
+    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
+    if (selfobj == NULL)
+        return NULL;
+
+    // printf("TohilTclDictIter\n");
+    // we don't need size but we use this to make tclobj is or can be a dict
+    int size = 0;
+    if (Tcl_DictObjSize(self->interp, selfobj, &size) == TCL_ERROR) {
+        PyErr_Format(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+        return NULL;
+    }
+
+    Tohil_TD_IterObj *pIter = (Tohil_TD_IterObj *)PyObject_New(Tohil_TD_IterObj, itertype);
+
+    pIter->interp = self->interp;
+    pIter->started = 0;
+    pIter->done = 0;
+    pIter->to = self->to;
+    pIter->toKind = self->toKind;
+    Py_XINCREF(pIter->to);
+
+    memset((void *)&pIter->search, 0, sizeof(Tcl_DictSearch));
+
+    pIter->dictObj = selfobj;
+    Tcl_IncrRefCount(pIter->dictObj);
+
+    return (PyObject *)pIter;
+}
+
+//
+// TohilTclDictIter() - returns a tcldict iterator object that can
+//   iterate over a tcldict.
+//
+static PyObject *
+TohilTclDictIter(TohilTclObj *self)
+{
+    return TohilTclDictIter_new(self, &Tohil_TD_IterType);
+}
+
+static PyObject *
+TohilTclDict_keys_new(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return TohilTclDictIter_new(self, &Tohil_TD_IterKeysType);
+}
+
+static PyObject *
+TohilTclDict_values_new(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return TohilTclDictIter_new(self, &Tohil_TD_IterValuesType);
+}
+
+static PyObject *
+TohilTclDict_items_new(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return TohilTclDictIter_new(self, &Tohil_TD_IterItemsType);
+}
+
+//
+// TohilTclDict_Contains - return 0 if key or keys is not
+//   contained in tcldict, 1 if it is, or -1 if there was
+//   an error.
+//
+static int
+TohilTclDict_Contains(PyObject *self, PyObject *keys)
+{
+    // printf("TohilTclDict_Contains\n");
+    Tcl_Obj *valueObj = TohilTclDict_td_locate((TohilTclObj *)self, keys);
+    if (valueObj == NULL) {
+        if (PyErr_Occurred() != NULL) {
+            return -1;
+        }
+        return 0;
+    }
+    return 1;
+}
+
+static PyMappingMethods TohilTclDict_as_mapping = {(lenfunc)TohilTclDict_length, (binaryfunc)TohilTclDict_subscript,
+                                                   (objobjargproc)TohilTclDict_ass_sub};
+
+static PySequenceMethods TohilTclDict_as_sequence = {
+    .sq_contains = TohilTclDict_Contains,
+};
+
+PyDoc_STRVAR(keys__doc__, "D.keys() -> a set-like object providing a view on D's keys");
+PyDoc_STRVAR(items__doc__, "D.items() -> a set-like object providing a view on D's items");
+PyDoc_STRVAR(values__doc__, "D.values() -> an object providing a view on D's values");
+
+static PyMethodDef TohilTclDict_methods[] = {
+    {"__getitem__", (PyCFunction)(void (*)(void))TohilTclDict_subscript, METH_O | METH_COEXIST, "x.__getitem__(y) <==> x[y]"},
+    {"get", (PyCFunction)(void (*)(void))TohilTclDict_td_get, METH_FASTCALL | METH_KEYWORDS, "get from tcl dict"},
+    // NB i don't know if this __len__ thing works -- python might
+    // be doing something gross to get the len of the dict, like
+    // enumerating the elements
+    {"__len__", (PyCFunction)TohilTclDict_size, METH_NOARGS, "get length of tcl dict"},
+    {"keys", (PyCFunction)TohilTclDict_keys_new, METH_NOARGS, keys__doc__},
+    {"items", (PyCFunction)TohilTclDict_items_new, METH_NOARGS, items__doc__},
+    {"values", (PyCFunction)TohilTclDict_values_new, METH_NOARGS, values__doc__},
+    {"td_set", (PyCFunction)(void (*)(void))TohilTclDict_td_set, METH_FASTCALL | METH_KEYWORDS, "set item in tcl dict"},
+    {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
+    {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
+    {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
+    {"clear", (PyCFunction)TohilTclObj_clear, METH_NOARGS, "remove all items from the tcl dict"},
+    {NULL} // sentinel
+};
+
+// NB need to change tp_itr, to_as_squence, to_as_mapping to do dict stuff
+
+static PyTypeObject TohilTclDictType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+        // .tp_base = &TohilTclObjType, NB - len() breaks when we inherit
+        .tp_name = "tohil.tcldict",
+    .tp_doc = "Tcl TD tcldict Object",
+    .tp_basicsize = sizeof(TohilTclObj),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = TohilTclObj_new,
+    .tp_init = (initproc)TohilTclObj_init,
+    .tp_dealloc = (destructor)TohilTclObj_dealloc,
+    .tp_methods = TohilTclDict_methods,
+    .tp_str = (reprfunc)TohilTclObj_str,
+    .tp_iter = (getiterfunc)TohilTclDictIter,
+    .tp_as_mapping = &TohilTclDict_as_mapping,
+    .tp_as_sequence = &TohilTclDict_as_sequence,
+    .tp_repr = (reprfunc)TohilTclObj_repr,
+    .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
+    .tp_getset = TohilTclObj_getsetters,
+};
+
+//
+//
+// end of tcldict python datatype
+//
+//
+
+//
+// start of trampoline python datatype
+//
+// a trampoline is a python callable that calls a tcl proc or C command,
+// binding python positional and named arguments onto the proc's
+// arguments the way TclProc always has.  the proc's argument names and
+// default values are worked out once when the trampoline is set up, so
+// each call just sorts its arguments into slots, fills in defaults and
+// hands tcl an objv.
+//
+// TclProc in pysrc/tohil/__init__.py is a subclass of this.
+//
+typedef struct {
+    PyObject_HEAD;
+    vectorcallfunc vectorcall;
+    Tcl_Interp *interp;
+    Tcl_Obj *procObj;    // name of the tcl proc or command
+    PyObject *to;        // default type to convert results to, or NULL
+    enum TohilToKind toKind;
+    int isProc;          // false for a C command, whose arguments we can't know
+    int nparams;         // number of proc arguments, not counting a trailing "args"
+    int hasArgs;         // true if the proc's last argument is "args"
+    PyObject **names;    // python str names of the nparams arguments
+    Tcl_Obj **defaults;  // default value of each argument, NULL if none
+} TohilTrampoline;
+
+static PyObject *TohilTrampoline_vectorcall(PyObject *callable, PyObject *const *args, size_t nargsf, PyObject *kwnames);
+
+//
+// TohilTrampoline_clear_slots - free a trampoline's argument table
+//
+static void
+TohilTrampoline_clear_slots(TohilTrampoline *self)
+{
+    for (int i = 0; i < self->nparams; i++) {
+        Py_XDECREF(self->names[i]);
+        if (self->defaults[i] != NULL)
+            Tcl_DecrRefCount(self->defaults[i]);
+    }
+    if (self->names != NULL)
+        ckfree(self->names);
+    if (self->defaults != NULL)
+        ckfree(self->defaults);
+    self->names = NULL;
+    self->defaults = NULL;
+    self->nparams = 0;
+    self->hasArgs = 0;
+    self->isProc = 0;
+}
+
+//
+// create a new, empty python trampoline object
+//
+static PyObject *
+TohilTrampoline_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    // grab pointer to tcl interp
+    PyObject *main_module = PyImport_AddModule("__main__");
+    PyObject *pCap = PyObject_GetAttrString(main_module, TOHIL_TCL_INTERP_STASH_NAME);
+    assert(pCap != NULL);
+    Tcl_Interp *interp = PyCapsule_GetPointer(pCap, TCL_TCL_INTERP_CAPSULE_NAME);
+    Py_DECREF(pCap);
+
+    TohilTrampoline *self = (TohilTrampoline *)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        self->vectorcall = TohilTrampoline_vectorcall;
+        self->interp = interp;
+        self->procObj = NULL;
+        self->to = NULL;
+        self->isProc = 0;
+        self->nparams = 0;
+        self->hasArgs = 0;
+        self->names = NULL;
+        self->defaults = NULL;
+    }
+    return (PyObject *)self;
+}
+
+//
+// init function for python trampoline type
+//
+// trampoline(proc, proc_args=None, defaults=None, *, to=None)
+//
+// proc_args is the list of the proc's argument names, as from
+// "info args", and defaults is a dict of argument names to their
+// default values.  if proc_args is None, proc is taken to be a
+// C command and the trampoline passes its arguments straight through.
+//
+static int
+TohilTrampoline_init(TohilTrampoline *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *pProc = NULL;
+    PyObject *pProcArgs = Py_None;
+    PyObject *pDefaults = Py_None;
+    PyObject *toType = Py_None;
+    static char *kwlist[] = {"proc", "proc_args", "defaults", "to", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "U|OO$O", kwlist, &pProc, &pProcArgs, &pDefaults, &toType)) {
+        return -1;
+    }
+
+    if (toType != Py_None && !tohil_check_toType(toType))
+        return -1;
+
+    if (pDefaults != Py_None && !PyDict_Check(pDefaults)) {
+        PyErr_SetString(PyExc_TypeError, "trampoline defaults must be a dict");
+        return -1;
+    }
+
+    Py_ssize_t procLen;
+    const char *procString = PyUnicode_AsUTF8AndSize(pProc, &procLen);
+    if (procString == NULL)
+        return -1;
+
+    // allow for being initialized more than once
+    TohilTrampoline_clear_slots(self);
+    if (self->procObj != NULL)
+        Tcl_DecrRefCount(self->procObj);
+    self->procObj = Tcl_NewStringObj(procString, procLen);
+    Tcl_IncrRefCount(self->procObj);
+
+    PyObject *tmp = self->to;
+    self->to = (toType == Py_None) ? NULL : toType;
+    self->toKind = tohil_to_kind(self->to);
+    Py_XINCREF(self->to);
+    Py_XDECREF(tmp);
+
+    if (pProcArgs == Py_None)
+        return 0;
+
+    // converting the defaults can run python code, so work from a
+    // copy of the names
+    PyObject *argNames = tohil_sequence_tuple(pProcArgs, "trampoline proc_args must be a sequence");
+    if (argNames == NULL)
+        return -1;
+
+    Py_ssize_t nargs = PyTuple_GET_SIZE(argNames);
+    PyObject **items = PySequence_Fast_ITEMS(argNames);
+
+    for (Py_ssize_t i = 0; i < nargs; i++) {
+        if (!PyUnicode_Check(items[i])) {
+            PyErr_SetString(PyExc_TypeError, "trampoline proc_args must all be strings");
+            Py_DECREF(argNames);
+            return -1;
+        }
+    }
+
+    // tcl's "args" is only special as the last argument
+    self->isProc = 1;
+    self->hasArgs = (nargs > 0 && PyUnicode_CompareWithASCIIString(items[nargs - 1], "args") == 0);
+    int nparams = (int)nargs - self->hasArgs;
+    self->names = (PyObject **)ckalloc(sizeof(PyObject *) * (nparams + 1));
+    self->defaults = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * (nparams + 1));
+
+    for (int i = 0; i < nparams; i++) {
+        self->names[i] = items[i];
+        Py_INCREF(items[i]);
+        self->defaults[i] = NULL;
+        self->nparams = i + 1;
+
+        if (pDefaults == Py_None)
+            continue;
+
+        PyObject *pDefault = PyDict_GetItemWithError(pDefaults, items[i]);
+        if (pDefault == NULL) {
+            if (PyErr_Occurred()) {
+                Py_DECREF(argNames);
+                return -1;
+            }
+            continue;
+        }
+        // the dict's reference could go away while it's converted
+        Py_INCREF(pDefault);
+        Tcl_Obj *defaultObj = pyObjToTcl(self->interp, pDefault);
+        Py_DECREF(pDefault);
+        if (defaultObj == NULL) {
+            Py_DECREF(argNames);
+            return -1;
+        }
+        self->defaults[i] = defaultObj;
+        Tcl_IncrRefCount(defaultObj);
+    }
+    Py_DECREF(argNames);
+    return 0;
+}
+
+//
+// deallocate function for python trampoline type
+//
+static void
+TohilTrampoline_dealloc(TohilTrampoline *self)
+{
+    TohilTrampoline_clear_slots(self);
+    if (self->procObj != NULL)
+        Tcl_DecrRefCount(self->procObj);
+    Py_XDECREF(self->to);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+//
+// TohilTrampoline_invoke - convert the python arguments to tcl, preceded
+//   by the proc name, invoke the proc, and return its result.  binding
+//   has already been done: each of the nbound elements of pArgs is a
+//   python object to convert, or NULL to use the tcl object at the same
+//   position in defaults, and the nextra elements of extraArgs go on the end.
 //
 static PyObject *
-TohilTclDict_size(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+TohilTrampoline_invoke(TohilTrampoline *self, PyObject *const *pArgs, int nbound, Tcl_Obj *const *defaults, PyObject *const *extraArgs,
+                       Py_ssize_t nextra, enum TohilToKind toKind, PyObject *to)
 {
-    int length = TohilTclDict_length(self);
-    if (length < 0) {
+    Tcl_Interp *interp = self->interp;
+    int objc = 1 + nbound + (int)nextra;
+    int nconverted = 1;
+    int i;
+
+    if (self->procObj == NULL) {
+        PyErr_SetString(PyExc_TypeError, "trampoline not initialized");
         return NULL;
     }
-    return PyLong_FromLong(length);
+
+    Tcl_Obj *staticObjv[TOHIL_STATIC_OBJV_SIZE];
+    Tcl_Obj **objv = (objc <= TOHIL_STATIC_OBJV_SIZE) ? staticObjv : (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
+    int tcl_result = TCL_ERROR;
+
+    objv[0] = self->procObj;
+    Tcl_IncrRefCount(objv[0]);
+
+    for (i = 0; i < nbound; i++, nconverted++) {
+        Tcl_Obj *obj = (pArgs[i] == NULL) ? defaults[i] : pyObjToTcl(interp, pArgs[i]);
+        if (obj == NULL)
+            goto cleanup;
+        objv[nconverted] = obj;
+        Tcl_IncrRefCount(obj);
+    }
+
+    for (i = 0; i < nextra; i++, nconverted++) {
+        Tcl_Obj *obj = pyObjToTcl(interp, extraArgs[i]);
+        if (obj == NULL)
+            goto cleanup;
+        objv[nconverted] = obj;
+        Tcl_IncrRefCount(obj);
+    }
+
+    tcl_result = Tcl_EvalObjv(interp, objc, objv, 0);
+
+cleanup:
+    for (i = 0; i < nconverted; i++) {
+        Tcl_DecrRefCount(objv[i]);
+    }
+    if (objv != staticObjv)
+        ckfree(objv);
+
+    if (nconverted < objc)
+        return NULL;
+    return tohil_python_return_kind(interp, tcl_result, toKind, to, Tcl_GetObjResult(interp));
 }
 
 //
-// TohilTclDictIter_new() - returns a tcldict iterator object that can
-//   iterate over a tcldict.
+// TohilTrampoline_vectorcall - call a trampoline.
+//
+// a "to" named argument is always taken to be the type to convert
+// the result to.  for a C command, all the other arguments have to
+// be positional and are passed through as they are.  for a proc,
+// named arguments are matched to proc arguments, positional arguments
+// fill the remaining ones in order, any left over go to "args" if the
+// proc has it, and defaults are used for whatever's still missing.
 //
 static PyObject *
-TohilTclDictIter_new(TohilTclObj *self, PyTypeObject *itertype)
-{
-    Tcl_Obj *selfobj = TohilTclObj_objptr(self);
-    if (selfobj == NULL)
+TohilTrampoline_vectorcall(PyObject *callable, PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+    TohilTrampoline *self = (TohilTrampoline *)callable;
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    Py_ssize_t nkw = (kwnames == NULL) ? 0 : PyTuple_GET_SIZE(kwnames);
+    PyObject *to = self->to;
+    enum TohilToKind toKind = self->toKind;
+    int nparams = self->nparams;
+    int i;
+    Py_ssize_t k;
+
+    // made with __new__ but __init__ never ran
+    if (self->procObj == NULL) {
+        PyErr_SetString(PyExc_TypeError, "trampoline not initialized");
         return NULL;
+    }
 
-    // printf("TohilTclDictIter\n");
-    // we don't need size but we use this to make tclobj is or can be a dict
-    int size = 0;
-    if (Tcl_DictObjSize(self->interp, selfobj, &size) == TCL_ERROR) {
-        PyErr_Format(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+    // pick out to=
+    Py_ssize_t toIndex = -1;
+    for (k = 0; k < nkw; k++) {
+        if (PyUnicode_CompareWithASCIIString(PyTuple_GET_ITEM(kwnames, k), "to") == 0) {
+            toIndex = k;
+            to = args[nargs + k];
+            if (!tohil_check_toType(to))
+                return NULL;
+            toKind = tohil_to_kind(to);
+            break;
+        }
+    }
+    Py_ssize_t nnamed = nkw - (toIndex >= 0);
+
+    if (!self->isProc) {
+        if (nnamed > 0) {
+            PyErr_Format(PyExc_TypeError, "can't specify named parameters to a tcl function that isn't a proc: '%s'",
+                         Tcl_GetString(self->procObj));
+            return NULL;
+        }
+        return TohilTrampoline_invoke(self, NULL, 0, NULL, args, nargs, toKind, to);
+    }
+
+    if (!self->hasArgs && nargs + nnamed > nparams) {
+        PyErr_Format(PyExc_TypeError, "too many arguments specified to be passed to tcl proc '%s'", Tcl_GetString(self->procObj));
         return NULL;
     }
 
-    Tohil_TD_IterObj *pIter = (Tohil_TD_IterObj *)PyObject_New(Tohil_TD_IterObj, itertype);
+    // one slot per proc argument
+    PyObject *staticSlots[TOHIL_STATIC_OBJV_SIZE];
+    PyObject **slots = (nparams <= TOHIL_STATIC_OBJV_SIZE) ? staticSlots : (PyObject **)ckalloc(sizeof(PyObject *) * nparams);
+    PyObject *namedArgs = NULL;
+    PyObject *const *extraArgs = NULL;
+    Py_ssize_t nextra = 0;
+    PyObject *result = NULL;
 
-    pIter->interp = self->interp;
-    pIter->started = 0;
-    pIter->done = 0;
-    pIter->to = self->to;
-    Py_XINCREF(pIter->to);
+    for (i = 0; i < nparams; i++)
+        slots[i] = NULL;
 
-    memset((void *)&pIter->search, 0, sizeof(Tcl_DictSearch));
+    // named arguments go into their argument's slot, except
+    // that args= supplies a sequence of arguments for "args"
+    for (k = 0; k < nkw; k++) {
+        if (k == toIndex)
+            continue;
+        PyObject *kwname = PyTuple_GET_ITEM(kwnames, k);
+        for (i = 0; i < nparams; i++) {
+            if (self->names[i] == kwname || PyUnicode_Compare(self->names[i], kwname) == 0)
+                break;
+        }
+        if (i < nparams) {
+            slots[i] = args[nargs + k];
+        } else if (self->hasArgs && PyUnicode_CompareWithASCIIString(kwname, "args") == 0) {
+            // a copy, as converting them can run python code
+            namedArgs = tohil_sequence_tuple(args[nargs + k], "args must be a sequence");
+            if (namedArgs == NULL)
+                goto done;
+            extraArgs = PySequence_Fast_ITEMS(namedArgs);
+            nextra = PyTuple_GET_SIZE(namedArgs);
+        } else {
+            PyErr_Format(PyExc_TypeError, "named parameter '%U' is not a valid arument for proc '%s'", kwname, Tcl_GetString(self->procObj));
+            goto done;
+        }
+    }
 
-    pIter->dictObj = selfobj;
-    Tcl_IncrRefCount(pIter->dictObj);
+    // positional arguments fill the argument slots that are still empty,
+    // in order, and whatever's left over goes to args
+    Py_ssize_t pos = 0;
+    for (i = 0; i < nparams && pos < nargs; i++) {
+        if (slots[i] == NULL)
+            slots[i] = args[pos++];
+    }
+    if (pos < nargs) {
+        extraArgs = args + pos;
+        nextra = nargs - pos;
+    }
 
-    return (PyObject *)pIter;
+    // anything still missing has to have a default
+    for (i = 0; i < nparams; i++) {
+        if (slots[i] == NULL && self->defaults[i] == NULL) {
+            PyErr_Format(PyExc_TypeError, "required arg '%U' missing", self->names[i]);
+            goto done;
+        }
+    }
+
+    result = TohilTrampoline_invoke(self, slots, nparams, self->defaults, extraArgs, nextra, toKind, to);
+
+done:
+    Py_XDECREF(namedArgs);
+    if (slots != staticSlots)
+        ckfree(slots);
+    return result;
 }
 
 //
-// TohilTclDictIter() - returns a tcldict iterator object that can
-//   iterate over a tcldict.
+// TohilTrampoline_getto - get "to" value, settable attribute for what
+//   type to convert the trampoline's results to by default
 //
 static PyObject *
-TohilTclDictIter(TohilTclObj *self)
-{
-    return TohilTclDictIter_new(self, &Tohil_TD_IterType);
-}
-
-static PyObject *
-TohilTclDict_keys_new(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+TohilTrampoline_getto(TohilTrampoline *self, void *closure)
 {
-    return TohilTclDictIter_new(self, &Tohil_TD_IterKeysType);
+    if (self->to == NULL) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(self->to);
+    return self->to;
 }
 
-static PyObject *
-TohilTclDict_values_new(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
+//
+// TohilTrampoline_setto - set "to" value.  None means str.
+//
+static int
+TohilTrampoline_setto(TohilTrampoline *self, PyObject *toType, void *closure)
 {
-    return TohilTclDictIter_new(self, &Tohil_TD_IterValuesType);
-}
+    if (toType == NULL) {
+        PyErr_SetString(PyExc_TypeError, "can't delete the to attribute");
+        return -1;
+    }
+    if (toType != Py_None && !tohil_check_toType(toType))
+        return -1;
 
-static PyObject *
-TohilTclDict_items_new(TohilTclObj *self, PyObject *Py_UNUSED(ignored))
-{
-    return TohilTclDictIter_new(self, &Tohil_TD_IterItemsType);
+    PyObject *tmp = self->to;
+    self->to = (toType == Py_None) ? NULL : toType;
+    self->toKind = tohil_to_kind(self->to);
+    Py_XINCREF(self->to);
+    Py_XDECREF(tmp);
+    return 0;
 }
 
 //
-// TohilTclDict_Contains - return 0 if key or keys is not
-//   contained in tcldict, 1 if it is, or -1 if there was
-//   an error.
+// repr() method for python trampoline type
 //
-static int
-TohilTclDict_Contains(PyObject *self, PyObject *keys)
+static PyObject *
+TohilTrampoline_repr(TohilTrampoline *self)
 {
-    // printf("TohilTclDict_Contains\n");
-    Tcl_Obj *valueObj = TohilTclDict_td_locate((TohilTclObj *)self, keys);
-    if (valueObj == NULL) {
-        if (PyErr_Occurred() != NULL) {
-            return -1;
-        }
-        return 0;
-    }
-    return 1;
+    return PyUnicode_FromFormat("<%s '%s'>", Py_TYPE(self)->tp_name, self->procObj == NULL ? "" : Tcl_GetString(self->procObj));
 }
 
-static PyMappingMethods TohilTclDict_as_mapping = {(lenfunc)TohilTclDict_length, (binaryfunc)TohilTclDict_subscript,
-                                                   (objobjargproc)TohilTclDict_ass_sub};
-
-static PySequenceMethods TohilTclDict_as_sequence = {
-    .sq_contains = TohilTclDict_Contains,
-};
-
-PyDoc_STRVAR(keys__doc__, "D.keys() -> a set-like object providing a view on D's keys");
-PyDoc_STRVAR(items__doc__, "D.items() -> a set-like object providing a view on D's items");
-PyDoc_STRVAR(values__doc__, "D.values() -> an object providing a view on D's values");
-
-static PyMethodDef TohilTclDict_methods[] = {
-    {"__getitem__", (PyCFunction)(void (*)(void))TohilTclDict_subscript, METH_O | METH_COEXIST, "x.__getitem__(y) <==> x[y]"},
-    {"get", (PyCFunction)TohilTclDict_td_get, METH_VARARGS | METH_KEYWORDS, "get from tcl dict"},
-    // NB i don't know if this __len__ thing works -- python might
-    // be doing something gross to get the len of the dict, like
-    // enumerating the elements
-    {"__len__", (PyCFunction)TohilTclDict_size, METH_VARARGS | METH_KEYWORDS, "get length of tcl dict"},
-    {"keys", (PyCFunction)TohilTclDict_keys_new, METH_NOARGS, keys__doc__},
-    {"items", (PyCFunction)TohilTclDict_items_new, METH_NOARGS, items__doc__},
-    {"values", (PyCFunction)TohilTclDict_values_new, METH_NOARGS, values__doc__},
-    {"td_set", (PyCFunction)TohilTclDict_td_set, METH_VARARGS | METH_KEYWORDS, "set item in tcl dict"},
-    {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
-    {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
-    {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
-    {"clear", (PyCFunction)TohilTclObj_clear, METH_NOARGS, "remove all items from the tcl dict"},
-    {NULL} // sentinel
-};
-
-// NB need to change tp_itr, to_as_squence, to_as_mapping to do dict stuff
+static PyGetSetDef TohilTrampoline_getsetters[] = {
+    {"to", (getter)TohilTrampoline_getto, (setter)TohilTrampoline_setto, "python type to convert results to by default", NULL},
+    {NULL}};
 
-static PyTypeObject TohilTclDictType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-        // .tp_base = &TohilTclObjType, NB - len() breaks when we inherit
-        .tp_name = "tohil.tcldict",
-    .tp_doc = "Tcl TD tcldict Object",
-    .tp_basicsize = sizeof(TohilTclObj),
+static PyTypeObject TohilTrampolineType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.trampoline",
+    .tp_doc = "callable that invokes a Tcl proc or command",
+    .tp_basicsize = sizeof(TohilTrampoline),
     .tp_itemsize = 0,
-    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
-    .tp_new = TohilTclObj_new,
-    .tp_init = (initproc)TohilTclObj_init,
-    .tp_dealloc = (destructor)TohilTclObj_dealloc,
-    .tp_methods = TohilTclDict_methods,
-    .tp_str = (reprfunc)TohilTclObj_str,
-    .tp_iter = (getiterfunc)TohilTclDictIter,
-    .tp_as_mapping = &TohilTclDict_as_mapping,
-    .tp_as_sequence = &TohilTclDict_as_sequence,
-    .tp_repr = (reprfunc)TohilTclObj_repr,
-    .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
-    .tp_getset = TohilTclObj_getsetters,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_VECTORCALL,
+    .tp_vectorcall_offset = offsetof(TohilTrampoline, vectorcall),
+    .tp_call = PyVectorcall_Call,
+    .tp_new = TohilTrampoline_new,
+    .tp_init = (initproc)TohilTrampoline_init,
+    .tp_dealloc = (destructor)TohilTrampoline_dealloc,
+    .tp_repr = (reprfunc)TohilTrampoline_repr,
+    .tp_getset = TohilTrampoline_getsetters,
 };
 
 //
-//
-// end of tcldict python datatype
-//
+// end of trampoline python datatype
 //
 
 // tohil_python_return - you call this routine when you have a tcl object
@@ -4055,16 +7594,13 @@ static PyTypeObject TohilTclDictType = {
 //   can convert the tcl object to a specific python type if the "to" type
 //   is not null.  (If null the conversion type defaults to str.)
 //
-// NB these strcmps could be replaced by more efficient direct
-// address comparisons if you grabbed the addresses of the type objects
-// we are insterested in compared to them
+// if you already know toKind, i.e. what tohil_to_kind says about
+// toType, call tohil_python_return_kind directly.  tohil_python_return
+// works it out and calls that.
 //
 static PyObject *
-tohil_python_return(Tcl_Interp *interp, int tcl_result, PyObject *toType, Tcl_Obj *resultObj)
+tohil_python_return_kind(Tcl_Interp *interp, int tcl_result, enum TohilToKind toKind, PyObject *toType, Tcl_Obj *resultObj)
 {
-    const char *toString = NULL;
-    PyTypeObject *pt = NULL;
-
     if (PyErr_Occurred() != NULL) {
         // printf("tohil_python_return invoked with a python error already present\n");
         // return NULL;
@@ -4108,122 +7644,443 @@ tohil_python_return(Tcl_Interp *interp, int tcl_result, PyObject *toType, Tcl_Ob
         return NULL;
     }
 
-    if (toType != NULL) {
-        if (!tohil_check_toType(toType))
+    switch (toKind) {
+    case TOHIL_TO_TCLOBJ:
+        return TohilTclObj_FromTclObj(interp, resultObj);
+
+    case TOHIL_TO_FROZENTCLOBJ:
+        return TohilFrozenTclObj_FromTclObj(interp, resultObj);
+
+    case TOHIL_TO_STR:
+        return tohil_TclObjToPyUnicode(interp, resultObj);
+
+    case TOHIL_TO_INT: {
+        PyObject *pLong;
+
+        if (tohil_TclObjToPyLong(interp, resultObj, &pLong) == TCL_OK) {
+            return pLong;
+        }
+        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return NULL;
+    }
+
+    case TOHIL_TO_BOOL: {
+        int boolValue;
+
+        if (Tcl_GetBooleanFromObj(interp, resultObj, &boolValue) == TCL_OK) {
+            PyObject *p = (boolValue ? Py_True : Py_False);
+            Py_INCREF(p);
+            return p;
+        }
+        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return NULL;
+    }
+
+    case TOHIL_TO_FLOAT: {
+        double doubleValue;
+
+        if (Tcl_GetDoubleFromObj(interp, resultObj, &doubleValue) == TCL_OK) {
+            return PyFloat_FromDouble(doubleValue);
+        }
+        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return NULL;
+    }
+
+    case TOHIL_TO_TCLDICT:
+        return TohilTclDict_FromTclObj(interp, resultObj);
+
+    case TOHIL_TO_LIST:
+        return tclListObjToPyListObject(interp, resultObj);
+
+    case TOHIL_TO_SET:
+        return tclListObjToPySetObject(interp, resultObj);
+
+    case TOHIL_TO_DICT:
+        // return tclListObjToPyDictObject(interp, resultObj);
+        return tclListObjToPyDictTclObjects(interp, resultObj);
+
+    case TOHIL_TO_TUPLE:
+        return tclListObjToPyTupleObject(interp, resultObj);
+
+    case TOHIL_TO_AUTO:
+        return tclObjToPyTyped(interp, resultObj);
+
+    case TOHIL_TO_CALLABLE: {
+        PyObject *result_tclobj = TohilTclObj_FromTclObj(interp, resultObj);
+        if (result_tclobj == NULL)
             return NULL;
+        PyObject *callResult = PyObject_CallFunctionObjArgs(toType, result_tclobj, NULL);
+        Py_DECREF(result_tclobj);
+        return callResult;
+    }
+
+    case TOHIL_TO_GENERIC:
+        return tohil_python_return_generic(interp, toType, resultObj);
+    }
+
+    PyErr_SetString(PyExc_TypeError, "'to' conversion type must be str, int, bool, float, list, set, dict, tuple, tohil.tclobj, tohil.tcldict, or a "
+                                     "callble python function taking a tclobj argument and returning something");
+    return NULL;
+}
+
+//
+// tohil_to_kind - say what a "to" type converts to.  the type should
+//   already have passed tohil_check_toType.  NULL means tclobj.
+//
+static enum TohilToKind
+tohil_to_kind(PyObject *toType)
+{
+    if (toType == NULL || toType == (PyObject *)&TohilTclObjType)
+        return TOHIL_TO_TCLOBJ;
+    if (toType == (PyObject *)&TohilFrozenTclObjType)
+        return TOHIL_TO_FROZENTCLOBJ;
+    if (toType == (PyObject *)&PyUnicode_Type)
+        return TOHIL_TO_STR;
+    if (toType == (PyObject *)&PyLong_Type)
+        return TOHIL_TO_INT;
+    if (toType == (PyObject *)&PyBool_Type)
+        return TOHIL_TO_BOOL;
+    if (toType == (PyObject *)&PyFloat_Type)
+        return TOHIL_TO_FLOAT;
+    if (toType == (PyObject *)&TohilTclDictType)
+        return TOHIL_TO_TCLDICT;
+    if (toType == (PyObject *)&PyList_Type)
+        return TOHIL_TO_LIST;
+    if (toType == (PyObject *)&PySet_Type)
+        return TOHIL_TO_SET;
+    if (toType == (PyObject *)&PyDict_Type)
+        return TOHIL_TO_DICT;
+    if (toType == (PyObject *)&PyTuple_Type)
+        return TOHIL_TO_TUPLE;
+    // each subinterpreter has its own tohil.auto, but they all
+    // share the C function
+    if (PyCFunction_Check(toType) && PyCFunction_GET_FUNCTION(toType) == (PyCFunction)tohil_auto)
+        return TOHIL_TO_AUTO;
+    // list[int] and typing.List[int] aren't types, but say what type
+    // they're a generic version of in __origin__
+    if (!PyType_Check(toType) && PyObject_HasAttrString(toType, "__origin__"))
+        return TOHIL_TO_GENERIC;
+    return TOHIL_TO_CALLABLE;
+}
+
+//
+// generic "to" types
+//
+// to= can be a generic alias like list[int], dict[str, float],
+// tuple[int, str, float] or dict[str, list[int]], or the typing
+// module equivalents, to say what to convert the elements of a
+// tcl list or dict to.  for each conversion we compile the alias
+// into a tree of specs, which we then use to convert all of the
+// elements in one pass, without making python strings of them first.
+//
+
+//
+// tohil_to_spec_free - free the element specs of a compiled spec
+//
+static void
+tohil_to_spec_free(TohilToSpec *spec)
+{
+    if (spec->args == NULL)
+        return;
+    for (int i = 0; i < spec->nargs; i++)
+        tohil_to_spec_free(&spec->args[i]);
+    ckfree(spec->args);
+    spec->args = NULL;
+}
+
+//
+// tohil_to_spec_compile - compile a "to" type into a spec.  the
+//   generic alias must stay alive for as long as the spec is used,
+//   because the spec borrows references from its __args__.
+//
+static int
+tohil_to_spec_compile(PyObject *to, TohilToSpec *spec)
+{
+    spec->to = to;
+    spec->nargs = 0;
+    spec->variadic = 0;
+    spec->args = NULL;
+    spec->kind = tohil_to_kind(to);
+    spec->callsPython = (spec->kind == TOHIL_TO_CALLABLE);
+
+    if (spec->kind != TOHIL_TO_GENERIC)
+        return 0;
+
+    PyObject *origin = PyObject_GetAttrString(to, "__origin__");
+    if (origin == NULL)
+        return -1;
+    spec->kind = tohil_to_kind(origin);
+    Py_DECREF(origin);
+
+    PyObject *argsTuple = PyObject_GetAttrString(to, "__args__");
+    if (argsTuple == NULL)
+        return -1;
+    // the alias holds __args__, so its elements outlive this reference
+    Py_DECREF(argsTuple);
+    if (!PyTuple_Check(argsTuple)) {
+        PyErr_Format(PyExc_TypeError, "to= generic %R has no __args__ tuple", to);
+        return -1;
+    }
+    Py_ssize_t nargs = PyTuple_GET_SIZE(argsTuple);
+
+    int ok;
+    switch (spec->kind) {
+    case TOHIL_TO_LIST:
+    case TOHIL_TO_SET:
+        ok = (nargs == 1);
+        break;
+
+    case TOHIL_TO_DICT:
+        ok = (nargs == 2);
+        break;
+
+    case TOHIL_TO_TUPLE:
+        // tuple[int, ...] means any number of ints
+        if (nargs == 2 && PyTuple_GET_ITEM(argsTuple, 1) == Py_Ellipsis) {
+            spec->variadic = 1;
+            nargs = 1;
+        }
+        ok = (nargs <= INT_MAX);
+        break;
+
+    default:
+        ok = 0;
+    }
 
-        // toType/pt is a borrowed reference; do not decrement its reference count
-        pt = (PyTypeObject *)toType;
-        toString = pt->tp_name;
+    if (!ok) {
+        PyErr_Format(PyExc_TypeError, "to= generic must be list[X], set[X], dict[K, V] or tuple[X, ...], not %R", to);
+        return -1;
     }
-    // printf("tohil_python_return called: tcl result %d, to=%s, resulObj '%s'\n", tcl_result, toString, Tcl_GetString(resultObj));
 
-    if (toType == NULL || STREQU(toString, "tohil.tclobj")) {
-        return TohilTclObj_FromTclObj(interp, resultObj);
+    if (nargs == 0) {
+        // tuple[()], the empty tuple, still needs to be a generic spec
+        // so it checks the length
+        spec->kind = TOHIL_TO_GENERIC;
+        return 0;
     }
 
-    if (STREQU(toString, "str")) {
-        int tclStringSize;
-        char *tclString;
-        int utf8len;
-        char *utf8string;
+    spec->args = (TohilToSpec *)ckalloc(sizeof(TohilToSpec) * nargs);
+    spec->nargs = (int)nargs;
+    for (int i = 0; i < spec->nargs; i++) {
+        spec->args[i].args = NULL;
+        spec->args[i].nargs = 0;
+    }
+    for (int i = 0; i < spec->nargs; i++) {
+        if (tohil_to_spec_compile(PyTuple_GET_ITEM(argsTuple, i), &spec->args[i]) < 0) {
+            tohil_to_spec_free(spec);
+            return -1;
+        }
+        spec->callsPython |= spec->args[i].callsPython;
+    }
+    return 0;
+}
 
-        tclString = Tcl_GetStringFromObj(resultObj, &tclStringSize);
-        if (tohil_TclToUTF8(interp, tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+//
+// tohil_to_spec_convert_list - convert the elements of a tcl list as a
+//   compiled generic spec says
+//
+static PyObject *
+tohil_to_spec_convert_list(Tcl_Interp *interp, TohilToSpec *spec, int count, Tcl_Obj **list)
+{
+    switch (spec->kind) {
+    case TOHIL_TO_LIST: {
+        PyObject *plist = PyList_New(count);
+        if (plist == NULL)
             return NULL;
+        for (int i = 0; i < count; i++) {
+            PyObject *pElement = tohil_to_spec_convert(interp, &spec->args[0], list[i]);
+            if (pElement == NULL) {
+                Py_DECREF(plist);
+                return NULL;
+            }
+            PyList_SET_ITEM(plist, i, pElement);
         }
-        PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-        ckfree(utf8string);
-        return pObj;
+        return plist;
     }
 
-    if (STREQU(toString, "int")) {
-        Tcl_WideInt wideValue;
-
-        if (Tcl_GetWideIntFromObj(interp, resultObj, &wideValue) == TCL_OK) {
-            return PyLong_FromLongLong(wideValue);
+    case TOHIL_TO_SET: {
+        PyObject *pset = PySet_New(NULL);
+        if (pset == NULL)
+            return NULL;
+        for (int i = 0; i < count; i++) {
+            PyObject *pElement = tohil_to_spec_convert(interp, &spec->args[0], list[i]);
+            if (pElement == NULL || PySet_Add(pset, pElement) < 0) {
+                Py_XDECREF(pElement);
+                Py_DECREF(pset);
+                return NULL;
+            }
+            Py_DECREF(pElement);
         }
-        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
-        return NULL;
+        return pset;
     }
 
-    if (STREQU(toString, "bool")) {
-        int boolValue;
+    case TOHIL_TO_DICT: {
+        if (count % 2 != 0) {
+            PyErr_SetString(PyExc_TypeError, "list doesn't have an even number of elements");
+            return NULL;
+        }
+        PyObject *pdict = PyDict_New();
+        if (pdict == NULL)
+            return NULL;
+        for (int i = 0; i < count; i += 2) {
+            PyObject *pKey;
+            if (spec->args[0].kind == TOHIL_TO_STR && spec->args[0].nargs == 0)
+                pKey = tohil_TclObjToPyKey(interp, list[i]);
+            else
+                pKey = tohil_to_spec_convert(interp, &spec->args[0], list[i]);
+            if (pKey == NULL) {
+                Py_DECREF(pdict);
+                return NULL;
+            }
+            PyObject *pValue = tohil_to_spec_convert(interp, &spec->args[1], list[i + 1]);
+            int result = (pValue == NULL) ? -1 : PyDict_SetItem(pdict, pKey, pValue);
+            Py_DECREF(pKey);
+            Py_XDECREF(pValue);
+            if (result < 0) {
+                Py_DECREF(pdict);
+                return NULL;
+            }
+        }
+        return pdict;
+    }
 
-        if (Tcl_GetBooleanFromObj(interp, resultObj, &boolValue) == TCL_OK) {
-            PyObject *p = (boolValue ? Py_True : Py_False);
-            Py_INCREF(p);
-            return p;
+    default:
+        // tuples; tuple[()] is left as TOHIL_TO_GENERIC
+        if (!spec->variadic && count != spec->nargs) {
+            PyErr_Format(PyExc_ValueError, "to=%R expects a list of %d elements, got %d", spec->to, spec->nargs, count);
+            return NULL;
         }
-        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
-        return NULL;
+        PyObject *ptuple = PyTuple_New(count);
+        if (ptuple == NULL)
+            return NULL;
+        for (int i = 0; i < count; i++) {
+            PyObject *pElement = tohil_to_spec_convert(interp, &spec->args[spec->variadic ? 0 : i], list[i]);
+            if (pElement == NULL) {
+                Py_DECREF(ptuple);
+                return NULL;
+            }
+            PyTuple_SET_ITEM(ptuple, i, pElement);
+        }
+        return ptuple;
     }
+}
 
-    if (STREQU(toString, "float")) {
-        double doubleValue;
+//
+// tohil_to_spec_convert - convert a tcl object as a compiled spec says
+//
+static PyObject *
+tohil_to_spec_convert(Tcl_Interp *interp, TohilToSpec *spec, Tcl_Obj *obj)
+{
+    Tcl_Obj **list;
+    int count;
 
-        if (Tcl_GetDoubleFromObj(interp, resultObj, &doubleValue) == TCL_OK) {
-            return PyFloat_FromDouble(doubleValue);
-        }
-        PyErr_SetString(PyExc_ValueError, Tcl_GetString(Tcl_GetObjResult(interp)));
+    if (spec->nargs == 0 && spec->kind != TOHIL_TO_GENERIC)
+        return tohil_python_return_kind(interp, TCL_OK, spec->kind, spec->to, obj);
+
+    if (Tcl_ListObjGetElements(interp, obj, &count, &list) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
         return NULL;
     }
 
-    if (STREQU(toString, "tohil.tcldict")) {
-        return TohilTclDict_FromTclObj(interp, resultObj);
-    }
+    if (!spec->callsPython)
+        return tohil_to_spec_convert_list(interp, spec, count, list);
 
-    if (STREQU(toString, "list")) {
-        return tclListObjToPyListObject(interp, resultObj);
-    }
+    // python code run while converting could get at the list and use
+    // it as something else, a dict say, freeing the element array out
+    // from under us.  so work from a private list of the same elements.
+    Tcl_Obj *privateObj = Tcl_NewListObj(count, list);
+    Tcl_IncrRefCount(privateObj);
+    Tcl_ListObjGetElements(NULL, privateObj, &count, &list);
+    PyObject *pResult = tohil_to_spec_convert_list(interp, spec, count, list);
+    Tcl_DecrRefCount(privateObj);
+    return pResult;
+}
 
-    if (STREQU(toString, "set")) {
-        return tclListObjToPySetObject(interp, resultObj);
-    }
+//
+// tohil_python_return_generic - convert a tcl object to what a generic
+//   alias "to" type says
+//
+static PyObject *
+tohil_python_return_generic(Tcl_Interp *interp, PyObject *toType, Tcl_Obj *resultObj)
+{
+    TohilToSpec spec;
 
-    if (STREQU(toString, "dict")) {
-        // return tclListObjToPyDictObject(interp, resultObj);
-        return tclListObjToPyDictTclObjects(interp, resultObj);
-    }
+    if (tohil_to_spec_compile(toType, &spec) < 0)
+        return NULL;
 
-    if (STREQU(toString, "tuple")) {
-        return tclListObjToPyTupleObject(interp, resultObj);
-    }
+    // the result may be the interpreter result, which tcl code run
+    // by a callable element type would replace, so hold onto it
+    Tcl_IncrRefCount(resultObj);
+    PyObject *pResult = tohil_to_spec_convert(interp, &spec, resultObj);
+    Tcl_DecrRefCount(resultObj);
+    tohil_to_spec_free(&spec);
+    return pResult;
+}
 
-    if (PyCallable_Check(toType)) {
-        PyObject *result_tclobj = TohilTclObj_FromTclObj(interp, resultObj);
-        if (result_tclobj == NULL)
-            return NULL;
-        PyObject *callResult = PyObject_CallFunctionObjArgs(toType, result_tclobj, NULL);
-        Py_DECREF(result_tclobj);
-        return callResult;
+//
+// tohil_python_return - convert to what a "to" type says, when it's
+//   only known as a python object
+//
+static PyObject *
+tohil_python_return(Tcl_Interp *interp, int tcl_result, PyObject *toType, Tcl_Obj *resultObj)
+{
+    if (tcl_result != TCL_ERROR && toType != NULL && !tohil_check_toType(toType))
+        return NULL;
+
+    return tohil_python_return_kind(interp, tcl_result, tohil_to_kind(toType), toType, resultObj);
+}
+
+//
+// tohil_cached_script - return the tcl object for a script or expression
+//   coming from python, from the interpreter's cache if it's there.
+//   tcl keeps the compiled bytecode in the object, so reusing it
+//   saves having to compile it again.
+//
+//   the object is returned with a reference that the caller must
+//   release when it's done with it.
+//
+static Tcl_Obj *
+tohil_cached_script(Tcl_Interp *interp, TohilCache *cache, const char *utf8Script, Py_ssize_t utf8ScriptLen)
+{
+    Tcl_Obj *scriptObj = (Tcl_Obj *)tohil_cache_get(cache, utf8Script);
+
+    if (scriptObj == NULL) {
+        Tcl_DString ds;
+        char *tclScript = tohil_UTF8ToTclDString(interp, (char *)utf8Script, utf8ScriptLen, &ds);
+        scriptObj = Tcl_NewStringObj(tclScript, Tcl_DStringLength(&ds));
+        Tcl_DStringFree(&ds);
+        Tcl_IncrRefCount(scriptObj);
+        tohil_cache_put(cache, utf8Script, scriptObj);
     }
 
-    PyErr_SetString(PyExc_TypeError, "'to' conversion type must be str, int, bool, float, list, set, dict, tuple, tohil.tclobj, tohil.tcldict, or a "
-                                     "callble python function taking a tclobj argument and returning something");
-    return NULL;
+    Tcl_IncrRefCount(scriptObj);
+    return scriptObj;
 }
 
 //
 // tohil.eval command for python to eval code in the tcl interpreter
 //
 static PyObject *
-tohil_eval(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_eval(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"tcl_code", "to", NULL};
-    PyObject *to = NULL;
-    char *utf8Code = NULL;
+    static const char *const kwlist[] = {"tcl_code", "to"};
+    static const TohilArgSpec spec = {"eval", kwlist, 2, 1, 1};
+    PyObject *slots[2];
+    Py_ssize_t utf8CodeLen;
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$O", kwlist, &utf8Code, &to))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
 
-    // TODO modify the above PyArg_ParseTupleAndKeywords to return a length?
-    Tcl_DString ds;
-    char *tclCode = tohil_UTF8ToTclDString(interp, utf8Code, -1, &ds);
-    int result = Tcl_Eval(interp, tclCode);
-    Tcl_DStringFree(&ds);
+    const char *utf8Code = tohil_arg_string(&spec, slots[0], &utf8CodeLen);
+    if (utf8Code == NULL)
+        return NULL;
+    PyObject *to = slots[1];
+
+    TohilPyterps *pyterps = (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    Tcl_Obj *scriptObj = tohil_cached_script(interp, &pyterps->scriptCache, utf8Code, utf8CodeLen);
+    int result = Tcl_EvalObjEx(interp, scriptObj, 0);
+    Tcl_DecrRefCount(scriptObj);
     Tcl_Obj *resultObj = Tcl_GetObjResult(interp);
 
     return tohil_python_return(interp, result, to, resultObj);
@@ -4233,27 +8090,38 @@ tohil_eval(PyObject *m, PyObject *args, PyObject *kwargs)
 // tohil.expr command for python to evaluate expressions using the tcl interpreter
 //
 static PyObject *
-tohil_expr(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_expr(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"expression", "to", NULL};
-    char *utf8expression = NULL;
-    PyObject *to = NULL;
+    static const char *const kwlist[] = {"expression", "to"};
+    static const TohilArgSpec spec = {"expr", kwlist, 2, 1, 1};
+    PyObject *slots[2];
+    Py_ssize_t utf8expressionLen;
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$O", kwlist, &utf8expression, &to))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
 
-    Tcl_DString ds;
-    char *expression = tohil_UTF8ToTclDString(interp, utf8expression, -1, &ds);
+    const char *utf8expression = tohil_arg_string(&spec, slots[0], &utf8expressionLen);
+    if (utf8expression == NULL)
+        return NULL;
+    PyObject *to = slots[1];
+
+    TohilPyterps *pyterps = (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    Tcl_Obj *expressionObj = tohil_cached_script(interp, &pyterps->exprCache, utf8expression, utf8expressionLen);
 
     Tcl_Obj *resultObj = NULL;
-    if (Tcl_ExprObj(interp, Tcl_NewStringObj(expression, -1), &resultObj) == TCL_ERROR) {
+    int result = Tcl_ExprObj(interp, expressionObj, &resultObj);
+    Tcl_DecrRefCount(expressionObj);
+    if (result == TCL_ERROR) {
         char *errMsg = Tcl_GetString(Tcl_GetObjResult(interp));
         PyErr_SetString(PyExc_RuntimeError, errMsg);
         return NULL;
     }
 
-    return tohil_python_return(interp, TCL_OK, to, resultObj);
+    // Tcl_ExprObj gave us a reference to the result
+    PyObject *pResult = tohil_python_return(interp, TCL_OK, to, resultObj);
+    Tcl_DecrRefCount(resultObj);
+    return pResult;
 }
 
 //
@@ -4261,16 +8129,19 @@ tohil_expr(PyObject *m, PyObject *args, PyObject *kwargs)
 // to a tcl object and then convert it to a to= destination type
 //
 static PyObject *
-tohil_convert(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_convert(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"pyobject", "to", NULL};
-    PyObject *pyInputObject = NULL;
-    PyObject *to = NULL;
+    static const char *const kwlist[] = {"pyobject", "to"};
+    static const TohilArgSpec spec = {"convert", kwlist, 2, 1, 1};
+    PyObject *slots[2];
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$O", kwlist, &pyInputObject, &to))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
 
+    PyObject *pyInputObject = slots[0];
+    PyObject *to = slots[1];
+
     Tcl_Obj *interimObj = pyObjToTcl(interp, pyInputObject);
     if (interimObj == NULL) {
         return NULL;
@@ -4279,22 +8150,110 @@ tohil_convert(PyObject *m, PyObject *args, PyObject *kwargs)
     return tohil_python_return(interp, TCL_OK, to, interimObj);
 }
 
+//
+// tohil.auto - convert a python object to tcl and back, turning it into
+//   whatever python type matches what tcl knows it to be.  mostly this
+//   is used as to=tohil.auto, which converts tcl results the same way
+//   without calling it.
+//
+static PyObject *
+tohil_auto(PyObject *m, PyObject *pObj)
+{
+    Tcl_Interp *interp = tohilstate(m)->interp;
+
+    Tcl_Obj *obj = pyObjToTcl(interp, pObj);
+    if (obj == NULL)
+        return NULL;
+
+    Tcl_IncrRefCount(obj);
+    PyObject *pResult = tclObjToPyTyped(interp, obj);
+    Tcl_DecrRefCount(obj);
+    return pResult;
+}
+
+//
+// tohil.register_converter(type, converter) - convert objects of type,
+//   and of its subclasses, to tcl by calling converter on them and
+//   converting what it returns.  a converter of None removes the
+//   type's converter.
+//
+static PyObject *
+tohil_register_converter(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"type", "converter"};
+    static const TohilArgSpec spec = {"register_converter", kwlist, 2, 2, 2};
+    PyObject *slots[2];
+    Tcl_Interp *interp = tohilstate(m)->interp;
+
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+    PyObject *type = slots[0];
+    PyObject *converter = slots[1];
+
+    if (!PyType_Check(type)) {
+        PyErr_Format(PyExc_TypeError, "register_converter() argument 'type' must be a type, not %.50s", Py_TYPE(type)->tp_name);
+        return NULL;
+    }
+
+    // these are converted before any converter would be looked for
+    if (type == (PyObject *)&PyBaseObject_Type || type == (PyObject *)Py_TYPE(Py_None) || type == (PyObject *)&PyBool_Type ||
+        type == (PyObject *)&PyUnicode_Type || type == (PyObject *)&PyLong_Type || type == (PyObject *)&PyFloat_Type ||
+        type == (PyObject *)&PyList_Type || type == (PyObject *)&PyTuple_Type || type == (PyObject *)&PyDict_Type) {
+        PyErr_Format(PyExc_TypeError, "register_converter() can't register a converter for %.100s", ((PyTypeObject *)type)->tp_name);
+        return NULL;
+    }
+
+    if (converter != Py_None && !PyCallable_Check(converter)) {
+        PyErr_SetString(PyExc_TypeError, "register_converter() argument 'converter' must be callable or None");
+        return NULL;
+    }
+
+    TohilPyterps *pyterps = (TohilPyterps *)Tcl_GetAssocData(interp, TOHIL_ASSOC_PYTERPS, NULL);
+    assert(pyterps != NULL);
+
+    if (pyterps->converters == NULL) {
+        if (converter == Py_None)
+            Py_RETURN_NONE;
+        pyterps->converters = PyDict_New();
+        if (pyterps->converters == NULL)
+            return NULL;
+    }
+
+    if (converter == Py_None) {
+        if (PyDict_DelItem(pyterps->converters, type) < 0) {
+            if (!PyErr_ExceptionMatches(PyExc_KeyError))
+                return NULL;
+            PyErr_Clear();
+        }
+    } else if (PyDict_SetItem(pyterps->converters, type, converter) < 0) {
+        return NULL;
+    }
+
+    // types already looked at may convert differently now
+    tohil_type_cache_clear(pyterps);
+    Py_RETURN_NONE;
+}
+
 //
 // tohil.getvar - from python get the contents of a variable
 //
 static PyObject *
-tohil_getvar(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_getvar(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"var", "to", "default", NULL};
-    char *var = NULL;
-    PyObject *to = NULL;
-    PyObject *defaultPyObj = NULL;
+    static const char *const kwlist[] = {"var", "to", "default"};
+    static const TohilArgSpec spec = {"getvar", kwlist, 3, 1, 1};
+    PyObject *slots[3];
     Tcl_Obj *obj = NULL;
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$OO", kwlist, &var, &to, &defaultPyObj)) {
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
-    }
+
+    const char *var = tohil_arg_string(&spec, slots[0], NULL);
+    if (var == NULL)
+        return NULL;
+    PyObject *to = slots[1];
+    PyObject *defaultPyObj = slots[2];
 
     if (defaultPyObj == NULL) {
         // a default wasn't specified, it's an error if the var or array
@@ -4320,6 +8279,8 @@ tohil_getvar(PyObject *m, PyObject *args, PyObject *kwargs)
                 // they provided a to= conversion, run
                 // their python through that and return it.
                 obj = pyObjToTcl(interp, defaultPyObj);
+                if (obj == NULL)
+                    return NULL;
             }
         }
     }
@@ -4333,13 +8294,18 @@ tohil_getvar(PyObject *m, PyObject *args, PyObject *kwargs)
 // tohil.exists - from python see if a variable or array element exists in tcl
 //
 static PyObject *
-tohil_exists(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_exists(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"var", NULL};
-    char *var = NULL;
+    static const char *const kwlist[] = {"var"};
+    static const TohilArgSpec spec = {"exists", kwlist, 1, 1, 1};
+    PyObject *slots[1];
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$", kwlist, &var))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    const char *var = tohil_arg_string(&spec, slots[0], NULL);
+    if (var == NULL)
         return NULL;
 
     Tcl_Obj *obj = Tcl_GetVar2Ex(interp, var, NULL, 0);
@@ -4353,17 +8319,24 @@ tohil_exists(PyObject *m, PyObject *args, PyObject *kwargs)
 // tohil.setvar - set a variable or array element in tcl from python
 //
 static PyObject *
-tohil_setvar(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_setvar(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"var", "value", NULL};
-    char *var = NULL;
-    PyObject *pyValue = NULL;
+    static const char *const kwlist[] = {"var", "value"};
+    static const TohilArgSpec spec = {"setvar", kwlist, 2, 2, 2};
+    PyObject *slots[2];
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "sO", kwlist, &var, &pyValue))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    const char *var = tohil_arg_string(&spec, slots[0], NULL);
+    if (var == NULL)
         return NULL;
+    PyObject *pyValue = slots[1];
 
     Tcl_Obj *tclValue = pyObjToTcl(interp, pyValue);
+    if (tclValue == NULL)
+        return NULL;
 
     Tcl_Obj *obj = Tcl_SetVar2Ex(interp, var, NULL, tclValue, (TCL_LEAVE_ERR_MSG));
 
@@ -4379,15 +8352,22 @@ tohil_setvar(PyObject *m, PyObject *args, PyObject *kwargs)
 // tohil.incr - incr a variable or array element in tcl from python
 //
 static PyObject *
-tohil_incr(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_incr(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"var", "incr", NULL};
-    char *var = NULL;
+    static const char *const kwlist[] = {"var", "incr"};
+    static const TohilArgSpec spec = {"incr", kwlist, 2, 2, 1};
+    PyObject *slots[2];
     Tcl_WideInt wideValue = 0;
     long increment = 1;
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|l", kwlist, &var, &increment))
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+
+    const char *var = tohil_arg_string(&spec, slots[0], NULL);
+    if (var == NULL)
+        return NULL;
+    if (slots[1] != NULL && tohil_arg_long(slots[1], &increment) < 0)
         return NULL;
 
     Tcl_Obj *obj = Tcl_GetVar2Ex(interp, var, NULL, 0);
@@ -4407,7 +8387,8 @@ tohil_incr(PyObject *m, PyObject *args, PyObject *kwargs)
         wideValue += increment;
 
         if (Tcl_IsShared(obj)) {
-            Tcl_DecrRefCount(obj);
+            // the variable holds the only reference to obj we know
+            // about, and setting the variable will take care of it
             obj = Tcl_DuplicateObj(obj);
             Tcl_SetWideIntObj(obj, wideValue);
             if (Tcl_SetVar2Ex(interp, var, NULL, obj, (TCL_LEAVE_ERR_MSG)) == NULL) {
@@ -4425,16 +8406,17 @@ tohil_incr(PyObject *m, PyObject *args, PyObject *kwargs)
 //   exist.  if passed the name of an array with no subscripted element,
 //   the entire array is deleted
 static PyObject *
-tohil_unset(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_unset(PyObject *m, PyObject *const *args, Py_ssize_t nargs)
 {
-    Py_ssize_t objc = PyTuple_GET_SIZE(args);
-    int i;
+    static const TohilArgSpec spec = {"unset", NULL, 0, 0, 0};
+    Py_ssize_t i;
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    // for each argument convert the python object to a tcl object
-    // and store it in the tcl object vector
-    for (i = 0; i < objc; i++) {
-        char *var = (char *)PyUnicode_1BYTE_DATA(PyTuple_GET_ITEM(args, i));
+    // unset each variable named by an argument
+    for (i = 0; i < nargs; i++) {
+        const char *var = tohil_arg_string(&spec, args[i], NULL);
+        if (var == NULL)
+            return NULL;
         Tcl_UnsetVar(interp, var, 0);
     }
 
@@ -4447,16 +8429,20 @@ tohil_unset(PyObject *m, PyObject *args, PyObject *kwargs)
 // without evaluating the ultimate result, like eval would
 //
 static PyObject *
-tohil_subst(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_subst(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"string", "to", NULL};
-    char *string = NULL;
-    PyObject *to = NULL;
+    static const char *const kwlist[] = {"string", "to"};
+    static const TohilArgSpec spec = {"subst", kwlist, 2, 1, 1};
+    PyObject *slots[2];
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$O", kwlist, &string, &to)) {
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
-    }
+
+    const char *string = tohil_arg_string(&spec, slots[0], NULL);
+    if (string == NULL)
+        return NULL;
+    PyObject *to = slots[1];
     Tcl_Obj *obj = Tcl_SubstObj(interp, Tcl_NewStringObj(string, -1), TCL_SUBST_ALL);
     if (obj == NULL) {
         char *errMsg = Tcl_GetString(Tcl_GetObjResult(interp));
@@ -4473,29 +8459,40 @@ tohil_subst(PyObject *m, PyObject *args, PyObject *kwargs)
 // you avoid passing everything through eval.  here it is.
 //
 static PyObject *
-tohil_call(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_call(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    Py_ssize_t objc = PyTuple_GET_SIZE(args);
+    int objc = (int)nargs;
     int i;
     PyObject *to = NULL;
     Tcl_Interp *interp = tohilstate(m)->interp;
 
     //
-    // allocate an array of Tcl object pointers the same size
-    // as the number of arguments we received
-    Tcl_Obj **objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
-
-    // PyObject_Print(kwargs, stdout, 0);
-
-    // we need to process kwargs to get the to
-    if (kwargs != NULL) {
-        to = PyDict_GetItemString(kwargs, "to");
+    // use an array of Tcl object pointers on the stack for
+    // the usual small number of arguments, else allocate one
+    // the same size as the number of arguments we received
+    Tcl_Obj *staticObjv[TOHIL_STATIC_OBJV_SIZE];
+    Tcl_Obj **objv = (objc <= TOHIL_STATIC_OBJV_SIZE) ? staticObjv : (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
+
+    // the only keyword argument we look at is to
+    if (kwnames != NULL) {
+        Py_ssize_t nkw = PyTuple_GET_SIZE(kwnames);
+        for (Py_ssize_t k = 0; k < nkw; k++) {
+            if (PyUnicode_CompareWithASCIIString(PyTuple_GET_ITEM(kwnames, k), "to") == 0)
+                to = args[nargs + k];
+        }
     }
 
     // for each argument convert the python object to a tcl object
     // and store it in the tcl object vector
     for (i = 0; i < objc; i++) {
-        objv[i] = pyObjToTcl(interp, PyTuple_GET_ITEM(args, i));
+        objv[i] = pyObjToTcl(interp, args[i]);
+        if (objv[i] == NULL) {
+            while (i-- > 0)
+                Tcl_DecrRefCount(objv[i]);
+            if (objv != staticObjv)
+                ckfree(objv);
+            return NULL;
+        }
         Tcl_IncrRefCount(objv[i]);
     }
 
@@ -4506,24 +8503,141 @@ tohil_call(PyObject *m, PyObject *args, PyObject *kwargs)
     for (i = 0; i < objc; i++) {
         Tcl_DecrRefCount(objv[i]);
     }
-    ckfree(objv);
+    if (objv != staticObjv)
+        ckfree(objv);
 
     return tohil_python_return(interp, tcl_result, to, Tcl_GetObjResult(interp));
 }
 
 //
-// tohil.result - return the tcl interpreter result object
+// tohil.call_many - run a sequence of tcl commands, each given as a
+//   sequence of arguments like tohil.call takes, and return a list of
+//   their results.
+//
+// if a command fails, its exception takes its place in the list and
+// the rest still run, unless stop_on_error is true, in which case the
+// exception is raised.  one objv is reused for all of the commands.
 //
 static PyObject *
-tohil_result(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_call_many(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"to", NULL};
-    PyObject *to = NULL;
+    static const char *const kwlist[] = {"commands", "to", "stop_on_error"};
+    static const TohilArgSpec spec = {"call_many", kwlist, 3, 1, 1};
+    PyObject *slots[3];
     Tcl_Interp *interp = tohilstate(m)->interp;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$O", kwlist, &to)) {
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+    PyObject *to = slots[1];
+    int stopOnError = 0;
+    if (slots[2] != NULL && (stopOnError = PyObject_IsTrue(slots[2])) < 0)
+        return NULL;
+    if (to != NULL && !tohil_check_toType(to))
+        return NULL;
+    enum TohilToKind toKind = tohil_to_kind(to);
+
+    // work from copies of the commands and their arguments, as
+    // converting an argument or a result can run python code
+    PyObject *commands = tohil_sequence_tuple(slots[0], "call_many() argument must be a sequence of commands");
+    if (commands == NULL)
+        return NULL;
+
+    Py_ssize_t ncommands = PyTuple_GET_SIZE(commands);
+    PyObject *results = PyList_New(ncommands);
+    if (results == NULL) {
+        Py_DECREF(commands);
         return NULL;
     }
+
+    Tcl_Obj *staticObjv[TOHIL_STATIC_OBJV_SIZE];
+    Tcl_Obj **objv = staticObjv;
+    Py_ssize_t objvSize = TOHIL_STATIC_OBJV_SIZE;
+
+    for (Py_ssize_t c = 0; c < ncommands; c++) {
+        PyObject *command = PyTuple_GET_ITEM(commands, c);
+        PyObject *result = NULL;
+        PyObject *argSeq = NULL;
+
+        if (PyUnicode_Check(command) || PyBytes_Check(command)) {
+            PyErr_Format(PyExc_TypeError, "call_many() commands must be sequences of arguments, not %.50s", Py_TYPE(command)->tp_name);
+        } else {
+            argSeq = tohil_sequence_tuple(command, "call_many() commands must be sequences of arguments");
+        }
+
+        if (argSeq != NULL) {
+            Py_ssize_t objc = PyTuple_GET_SIZE(argSeq);
+            Py_ssize_t i;
+
+            if (objc > objvSize) {
+                if (objv != staticObjv)
+                    ckfree(objv);
+                objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
+                objvSize = objc;
+            }
+
+            for (i = 0; i < objc; i++) {
+                objv[i] = pyObjToTcl(interp, PyTuple_GET_ITEM(argSeq, i));
+                if (objv[i] == NULL)
+                    break;
+                Tcl_IncrRefCount(objv[i]);
+            }
+
+            if (i == objc) {
+                int tcl_result = Tcl_EvalObjv(interp, (int)objc, objv, 0);
+                result = tohil_python_return_kind(interp, tcl_result, toKind, to, Tcl_GetObjResult(interp));
+            }
+
+            while (--i >= 0) {
+                Tcl_DecrRefCount(objv[i]);
+            }
+            Py_DECREF(argSeq);
+        }
+
+        if (result == NULL) {
+            if (stopOnError)
+                goto fail;
+
+            // the exception becomes the command's result
+            PyObject *type, *value, *traceback;
+            PyErr_Fetch(&type, &value, &traceback);
+            PyErr_NormalizeException(&type, &value, &traceback);
+            if (traceback != NULL) {
+                PyException_SetTraceback(value, traceback);
+                Py_DECREF(traceback);
+            }
+            Py_DECREF(type);
+            result = value;
+        }
+        PyList_SET_ITEM(results, c, result);
+    }
+
+    if (objv != staticObjv)
+        ckfree(objv);
+    Py_DECREF(commands);
+    return results;
+
+fail:
+    if (objv != staticObjv)
+        ckfree(objv);
+    Py_DECREF(commands);
+    Py_DECREF(results);
+    return NULL;
+}
+
+//
+// tohil.result - return the tcl interpreter result object
+//
+static PyObject *
+tohil_result(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"to"};
+    static const TohilArgSpec spec = {"result", kwlist, 1, 0, 0};
+    PyObject *slots[1];
+    Tcl_Interp *interp = tohilstate(m)->interp;
+
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
+        return NULL;
+    PyObject *to = slots[0];
     Tcl_Obj *obj = Tcl_GetObjResult(interp);
     assert(obj != NULL); // i don't think this can ever be null
 
@@ -4560,9 +8674,7 @@ PythonCmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const ob
         return tohil_tcl_return(interp, prior, TCL_ERROR);
 
     for (i = 0; i < (objc - 1); i++) {
-        Tcl_DString ds;
-        PyObject *s = Py_BuildValue("s", tohil_TclObjToUTF8DString(interp, objv[i + 1], &ds));
-        Tcl_DStringFree(&ds);
+        PyObject *s = tohil_TclObjToPyUnicode(interp, objv[i + 1]);
         if (!s) {
             Py_DECREF(args);
             return tohil_tcl_return(interp, prior, TCL_ERROR);
@@ -4576,7 +8688,7 @@ PythonCmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const ob
     if (res == NULL)
         return Tohil_ReturnExceptionToTcl(interp, prior, "error in python object call");
 
-    obj_res = _pyObjToTcl(interp, res);
+    obj_res = pyObjToTcl(interp, res);
     if (obj_res == NULL) {
         Py_DECREF(res);
         return Tohil_ReturnExceptionToTcl(interp, prior, "error converting python object to tcl object");
@@ -4588,25 +8700,29 @@ PythonCmd(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const ob
 }
 
 static PyObject *
-tohil_register_callback(PyObject *m, PyObject *args, PyObject *kwargs)
+tohil_register_callback(PyObject *m, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     // Accepts a Python callable that will be invoked when the Tcl command with
     // the specificed name is executed.
     Tcl_Interp *interp = tohilstate(m)->interp;
     PythonCmd_ClientData *data;
-    static char *kwlist[] = {"name", "callback", NULL};
-    PyObject *callback = NULL;
-    char *name = NULL;
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "sO", kwlist, &name, &callback)) {
+    static const char *const kwlist[] = {"name", "callback"};
+    static const TohilArgSpec spec = {"register_callback", kwlist, 2, 2, 2};
+    PyObject *slots[2];
+    if (tohil_parse_fastcall(&spec, args, nargs, kwnames, slots) < 0)
         return NULL;
-    }
+
+    const char *name = tohil_arg_string(&spec, slots[0], NULL);
+    if (name == NULL)
+        return NULL;
+    PyObject *callback = slots[1];
     if (!PyCallable_Check(callback)) {
         PyErr_SetString(PyExc_RuntimeError, "callback argument is not callable");
         return NULL;
     }
 
     Tcl_DString ds;
-    char *tcl_name = tohil_UTF8ToTclDString(interp, name, -1, &ds);
+    char *tcl_name = tohil_UTF8ToTclDString(interp, (char *)name, -1, &ds);
     data = PyMem_NEW(PythonCmd_ClientData, 1);
     Py_INCREF(callback);
     data->func = callback;
@@ -4621,20 +8737,31 @@ tohil_register_callback(PyObject *m, PyObject *args, PyObject *kwargs)
 // these are the tohil.* ones like tohil.eval, tohil.call, etc
 //
 static PyMethodDef TohilMethods[] = {
-    {"eval", (PyCFunction)tohil_eval, METH_VARARGS | METH_KEYWORDS, "Evaluate tcl code"},
-    {"getvar", (PyCFunction)tohil_getvar, METH_VARARGS | METH_KEYWORDS, "get vars and array elements from the tcl interpreter"},
-    {"setvar", (PyCFunction)tohil_setvar, METH_VARARGS | METH_KEYWORDS, "set vars and array elements in the tcl interpreter"},
-    {"exists", (PyCFunction)tohil_exists, METH_VARARGS | METH_KEYWORDS, "check whether vars and array elements exist in the tcl interpreter"},
-    {"unset", (PyCFunction)tohil_unset, METH_VARARGS, "unset variables, array elements, or arrays from the tcl interpreter"},
-    {"incr", (PyCFunction)tohil_incr, METH_VARARGS | METH_KEYWORDS, "increment vars and array elements in the tcl interpreter"},
-    {"subst", (PyCFunction)tohil_subst, METH_VARARGS | METH_KEYWORDS, "perform Tcl command, variable and backslash substitutions on a string"},
-    {"expr", (PyCFunction)tohil_expr, METH_VARARGS | METH_KEYWORDS, "evaluate Tcl expression"},
-    {"convert", (PyCFunction)tohil_convert, METH_VARARGS | METH_KEYWORDS,
+    {"eval", (PyCFunction)(void (*)(void))tohil_eval, METH_FASTCALL | METH_KEYWORDS, "Evaluate tcl code"},
+    {"getvar", (PyCFunction)(void (*)(void))tohil_getvar, METH_FASTCALL | METH_KEYWORDS, "get vars and array elements from the tcl interpreter"},
+    {"setvar", (PyCFunction)(void (*)(void))tohil_setvar, METH_FASTCALL | METH_KEYWORDS, "set vars and array elements in the tcl interpreter"},
+    {"exists", (PyCFunction)(void (*)(void))tohil_exists, METH_FASTCALL | METH_KEYWORDS,
+     "check whether vars and array elements exist in the tcl interpreter"},
+    {"unset", (PyCFunction)(void (*)(void))tohil_unset, METH_FASTCALL, "unset variables, array elements, or arrays from the tcl interpreter"},
+    {"incr", (PyCFunction)(void (*)(void))tohil_incr, METH_FASTCALL | METH_KEYWORDS, "increment vars and array elements in the tcl interpreter"},
+    {"subst", (PyCFunction)(void (*)(void))tohil_subst, METH_FASTCALL | METH_KEYWORDS,
+     "perform Tcl command, variable and backslash substitutions on a string"},
+    {"expr", (PyCFunction)(void (*)(void))tohil_expr, METH_FASTCALL | METH_KEYWORDS, "evaluate Tcl expression"},
+    {"auto", (PyCFunction)tohil_auto, METH_O, "convert to the python type matching what tcl knows an object to be; use as to=tohil.auto"},
+    {"convert", (PyCFunction)(void (*)(void))tohil_convert, METH_FASTCALL | METH_KEYWORDS,
      "convert python to tcl object then to whatever to= says or string and return"},
-    {"call", (PyCFunction)tohil_call, METH_VARARGS | METH_KEYWORDS, "invoke a tcl command with arguments"},
-    {"result", (PyCFunction)tohil_result, METH_VARARGS | METH_KEYWORDS, "return the tcl interpreter result object"},
-    {"register_callback", (PyCFunction)tohil_register_callback, METH_VARARGS | METH_KEYWORDS,
+    {"call", (PyCFunction)(void (*)(void))tohil_call, METH_FASTCALL | METH_KEYWORDS, "invoke a tcl command with arguments"},
+    {"call_many", (PyCFunction)(void (*)(void))tohil_call_many, METH_FASTCALL | METH_KEYWORDS,
+     "invoke a sequence of tcl commands, returning a list of results"},
+    {"result", (PyCFunction)(void (*)(void))tohil_result, METH_FASTCALL | METH_KEYWORDS, "return the tcl interpreter result object"},
+    {"register_callback", (PyCFunction)(void (*)(void))tohil_register_callback, METH_FASTCALL | METH_KEYWORDS,
      "Register a Python callable so it can be called directly from Tcl as a command"},
+    {"set_conversion_depth_limit", (PyCFunction)tohil_set_conversion_depth_limit, METH_O,
+     "set how deeply python containers can nest when converted to tcl"},
+    {"get_conversion_depth_limit", (PyCFunction)tohil_get_conversion_depth_limit, METH_NOARGS,
+     "return how deeply python containers can nest when converted to tcl"},
+    {"register_converter", (PyCFunction)(void (*)(void))tohil_register_converter, METH_FASTCALL | METH_KEYWORDS,
+     "register a function to convert a python type to something tohil can convert to tcl"},
     {NULL, NULL, 0, NULL} /* Sentinel */
 };
 
@@ -4672,6 +8799,11 @@ Tohil_Init(Tcl_Interp *interp)
     if (Tcl_InitStubs(interp, "8.6", 0) == NULL)
         return TCL_ERROR;
 
+#ifdef USE_TCL_STUBS
+    if (Tcl_TomMath_InitStubs(interp, "8.6") == NULL)
+        return TCL_ERROR;
+#endif
+
     if (Tcl_PkgRequire(interp, "Tcl", "8.6", 0) == NULL)
         return TCL_ERROR;
 
@@ -4779,6 +8911,9 @@ Tohil_Init(Tcl_Interp *interp)
     if (Tcl_CreateObjCommand(interp, "::tohil::call", (Tcl_ObjCmdProc *)TohilCall_Cmd, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL) == NULL)
         return TCL_ERROR;
 
+    if (Tcl_CreateObjCommand(interp, "::tohil::callmany", (Tcl_ObjCmdProc *)TohilCallMany_Cmd, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL) == NULL)
+        return TCL_ERROR;
+
     if (Tcl_CreateObjCommand(interp, "::tohil::import", (Tcl_ObjCmdProc *)TohilImport_Cmd, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL) == NULL)
         return TCL_ERROR;
 
@@ -4874,6 +9009,13 @@ tohil_mod_exec(PyObject *m)
         goto fail;
     }
 
+    // add our frozentclobj type to python
+    Py_INCREF(&TohilFrozenTclObjType);
+    if (PyModule_AddObject(m, "frozentclobj", (PyObject *)&TohilFrozenTclObjType) < 0) {
+        Py_DECREF(&TohilFrozenTclObjType);
+        goto fail;
+    }
+
     // add our tcldict type to python
     Py_INCREF(&TohilTclDictType);
     if (PyModule_AddObject(m, "tcldict", (PyObject *)&TohilTclDictType) < 0) {
@@ -4881,6 +9023,13 @@ tohil_mod_exec(PyObject *m)
         goto fail;
     }
 
+    // add our trampoline type to python
+    Py_INCREF(&TohilTrampolineType);
+    if (PyModule_AddObject(m, "trampoline", (PyObject *)&TohilTrampolineType) < 0) {
+        Py_DECREF(&TohilTrampolineType);
+        goto fail;
+    }
+
     // ..and stash a pointer to the tcl interpreter in a python
     // capsule so we can find it when we're doing python stuff
     // and need to talk to tcl
@@ -4925,6 +9074,14 @@ PyInit__tohil(void)
     if (PyType_Ready(&TohilTclObj_IterType) < 0)
         return NULL;
 
+    // turn up the frozentclobj type
+    if (PyType_Ready(&TohilFrozenTclObjType) < 0)
+        return NULL;
+
+    // turn up the tclobj chunk iterator type
+    if (PyType_Ready(&TohilTclObj_ChunkIterType) < 0)
+        return NULL;
+
     // turn up the tcldict iterator type
     if (PyType_Ready(&Tohil_TD_IterType) < 0)
         return NULL;
@@ -4942,6 +9099,10 @@ PyInit__tohil(void)
     if (PyType_Ready(&TohilTclDictType) < 0)
         return NULL;
 
+    // turn up the trampoline type
+    if (PyType_Ready(&TohilTrampolineType) < 0)
+        return NULL;
+
     // create the python module
     PyObject *m = PyModuleDef_Init(&TohilModule);
     if (m == NULL)
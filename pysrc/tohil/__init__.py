@@ -279,7 +279,9 @@ def rivet():
 # which looks for it upon load
 
 from tohil._tohil import (
+    auto,
     call,
+    call_many,
     eval,
     exists,
     expr,
@@ -288,11 +290,16 @@ from tohil._tohil import (
     subst,
     unset,
     tclobj,
+    frozentclobj,
     tcldict,
+    trampoline,
     convert,
     incr,
     result,
     register_callback,
+    set_conversion_depth_limit,
+    get_conversion_depth_limit,
+    register_converter,
     __version__,
 )
 
@@ -372,7 +379,26 @@ def doublecolon_tail(string):
     return string
 
 
-class TclProc:
+def _proc_to_function(proc):
+    """convert a tcl proc name to a python function name"""
+    function = doublecolon_tail(proc)
+    # python doesn't like dashes or colons in function names, so we map to underscores.
+    # "::" will map to "__" -- i think that's reasonable, at least for now.
+    # some other characters also appear in some tcl proc names out there, so we map
+    # them to other stuff.  tcl is too permissive, i feel like.
+    function = (
+        function.replace("-", "_")
+        .replace(":", "_")
+        .replace("?", "_question_mark")
+        .replace("+", "_plus_sign")
+        .replace("<", "_less_than")
+        .replace("@", "_at_sign")
+        .replace(">", "_greater_than")
+    )
+    return function
+
+
+class TclProc(trampoline):
     """instantiate with a tcl proc name as the argument.  the proc can be
     in any namespace but the name should be fully qualified.  although
     maybe not, not sure.
@@ -381,9 +407,10 @@ class TclProc:
     function written in C.  if it's a proc, it uses tcl's introspection
     to obtain the proc's arguments and default parameters, if any.
 
-    we define the __call__ method to check whether the tcl target is a proc
-    or C function and then call either our trampoline function or
-    passthrough_trampoline function, below.
+    calling a TclProc is handled by the trampoline type, written in C,
+    which binds the positional and named parameters onto the proc's
+    arguments, fills in defaults and calls the proc, or, for a C function,
+    passes the arguments straight through.
     """
 
     def __init__(self, proc, to=tclobj):
@@ -400,8 +427,6 @@ class TclProc:
             # print(f"info args failed for proc '{proc}'")
             self.is_proc = False
 
-        self.to_type = to
-
         if self.is_proc:
             # self.body = info_body(proc)
             self.defaults = dict()
@@ -411,23 +436,13 @@ class TclProc:
                 if int(has_default):
                     self.defaults[arg] = default_value
 
+            super().__init__(proc, self.proc_args, self.defaults, to=to)
+        else:
+            super().__init__(proc, to=to)
+
     def _proc_to_function(self, proc):
-        """conver ta tcl proc name to a python function name"""
-        function = doublecolon_tail(proc)
-        # python doesn't like dashes or colons in function names, so we map to underscores.
-        # "::" will map to "__" -- i think that's reasonable, at least for now.
-        # some other characters also appear in some tcl proc names out there, so we map
-        # them to other stuff.  tcl is too permissive, i feel like.
-        function = (
-            function.replace("-", "_")
-            .replace(":", "_")
-            .replace("?", "_question_mark")
-            .replace("+", "_plus_sign")
-            .replace("<", "_less_than")
-            .replace("@", "_at_sign")
-            .replace(">", "_greater_than")
-        )
-        return function
+        """convert a tcl proc name to a python function name"""
+        return _proc_to_function(proc)
 
     def __repr__(self):
         """repr function"""
@@ -436,18 +451,17 @@ class TclProc:
         else:
             return f"<class 'TclProc' '{self.proc}', c-function>"
 
-    def set_to(to):
-        self.to_type = to
+    @property
+    def to_type(self):
+        """the type results are converted to when to= isn't given"""
+        return self.to
 
-    def __call__(self, *args, **kwargs):
-        """this gets invoked when they call the object as if it is
-        a function.  we then return the results of our trampoline
-        or passthrough trampoline method, depending on if this instance
-        ingested a proc or C function"""
-        if self.is_proc:
-            return self.trampoline(args, kwargs)
-        else:
-            return self.passthrough_trampoline(args, kwargs)
+    @to_type.setter
+    def to_type(self, to):
+        self.to = to
+
+    def set_to(self, to):
+        self.to = to
 
     def passthrough_trampoline(self, args, kwargs):
         """passthrough trampoline function is for calling C functions on the tcl
@@ -455,137 +469,35 @@ class TclProc:
         treat everything as positional and pass through exactly what we get
 
         but we still support the to= conversion... :-)"""
-        if "to" in kwargs:
-            to_type = kwargs["to"]
-            del kwargs["to"]
-        else:
-            to_type = self.to_type
-
-        if len(kwargs) > 0:
-            raise TypeError(
-                f"can't specify named parameters to a tcl function that isn't a proc: '{self.proc}'"
-            )
-        return call(self.proc, *args, to=to_type)
+        return self(*args, **kwargs)
 
     def trampoline(self, args, kwargs):
         """trampoline function takes our proc probe data, positional parameters
         and named parameters, figures out if everything's there that the proc
         needs and calls the proc, or generates an exception for missing parameters,
-        too many parameters, unrecognized parameters, etc
-
-        if performance becomes an issue, this should be able to be converted to
-        C without great difficulty.  it's good in python while we figure it all out.
-        """
-        final = dict()
-
-        # print(f"trampoline invoked, self '{self}', args '{args}', kwargs '{kwargs}', defaults '{self.defaults}'")
-
-        if "to" in kwargs:
-            to_type = kwargs["to"]
-            del kwargs["to"]
-            # print(f"set aside to  of {to_type}")
-        else:
-            to_type = self.to_type
-
-        nargs = len(args)
-        if nargs + len(kwargs) > len(self.proc_args) and self.proc_args[-1] != "args":
-            raise TypeError(
-                f"too many arguments specified to be passed to tcl proc '{self.proc}'"
-            )
-
-        # pump any named parameters into the "final" dict
-        # print("checking named parameters")
-        for arg_name, arg in kwargs.items():
-            if arg_name in final:
-                raise TypeError(
-                    f"parameter '{arg_name}' specified multiple times -- can only specify it once"
-                )
-            if arg_name not in self.proc_args:
-                raise TypeError(
-                    f"named parameter '{arg_name}' is not a valid arument for proc '{self.proc}'"
-                )
-            # print(f"trampoline filling in named parameter {arg_name}, '{repr(arg)}'")
-            final[arg_name] = arg
-
-        # pump the positional arguments into the "final" dict
-        # these args are positional from the python side; python already split out
-        # named parameters into kwargs before calling us.
-        #
-        # advance, matching the tcl arg names to the args tuple, but if an
-        # arg name is already in the final array due to having come from
-        # a named parameter, advance to the next argument, without advancing
-        # the args list.
-        # print("checking positional parameters")
-        pos = 0
-        # for arg_name, arg in zip(self.proc_args, args):
-        for arg_name in self.proc_args:
-            if pos >= nargs:
-                break
-            if arg_name != "args":
-                if arg_name not in final:
-                    # a position parameter has been fulfilled
-                    final[arg_name] = args[pos]
-                    # print(f"trampoline filling in position arg {arg_name}, '{repr(args[pos])}'")
-                else:
-                    # already have this from a named parameter, skip but
-                    # keep the current positional parameter for the next arg
-                    continue
-            else:
-                # this argument is the tcl-special "args",
-                # grab the remainder of the arg list into args and stop iterating.
-                # we'll make use of this to handle args correctly in our call to tcl.
-                final[arg_name] = args[pos:]
-                break
-            pos += 1
-
-        # pump any default values, if needed, by checking for the existence
-        # of the default values' var names in the final array.  if it isn't
-        # there, put it there.  if it is there, the default isn't needed.
-        # print("checking defaults")
-        for arg_name, def_value in self.defaults.items():
-            if arg_name not in final:
-                # print(f"trampoline filling in default value {arg_name}, '{def_value}'")
-                final[arg_name] = def_value
-
-        # make sure we've got something for each of the proc's argument - if anything are
-        # missing, it's an error.
-        for arg_name in self.proc_args:
-            # it's ok if args is missing
-            if not arg_name in final and arg_name != "args":
-                raise TypeError(f"required arg '{arg_name}' missing")
-
-        # assemble the final argument list in the correct order for the proc
-        final_arg_list = list()
-        for arg_name in self.proc_args:
-            if arg_name != "args":
-                final_arg_list.append(final[arg_name])
-            else:
-                # it's "args". if we have args (because we may not, if there
-                # weren't enough arguments specified to have there be one), extend
-                # the final_arg_list with them, i.e. add them flat instead of nested,
-                # the way tcl will expect the args args
-                if "args" in final:
-                    final_arg_list.extend(final[arg_name])
-
-        # ...and invoke the proc
-        # print(f"trampoline calling {self.proc} with final of '{repr(final_arg_list)}'")
-        return call(self.proc, *final_arg_list, to=to_type)
+        too many parameters, unrecognized parameters, etc"""
+        return self(*args, **kwargs)
 
 
 class TclNamespace:
     """tcl namespace class -- one instance corresponds to a tcl namespace
 
-    it has the facility to import all the procs and C commands as TclProc
-    objects and keep track of them from the namespace
-
-
+    the procs and C commands in the namespace appear as TclProc objects,
+    and child namespaces as TclNamespace objects, accessed as attributes.
 
+    nothing is imported up front.  the first time an attribute is
+    looked up, the namespace lists its commands and children, just
+    their names, and only the proc or namespace that was asked for is
+    imported.  it is then stored as a regular attribute, so later lookups
+    don't come back here.  names that are known to be needed can be
+    imported ahead of time with __tohil_prefetch__.
     """
 
     proc_excluder = _keyword.kwlist
 
-    def __init__(self, namespace):
-        # print(f"{self} importing namespace '{namespace}'")
+    def __init__(self, namespace, prefetch=None):
+        self.__tohil_namespace__ = namespace
+
         # be able to find TclProcs by proc name and function name, for convenience,
         # not actually used for anything yet
         self.__tohil_procs__ = dict()
@@ -593,8 +505,95 @@ class TclNamespace:
 
         # keep track of subordinate namespaces
         self.__tohil_namespaces__ = dict()
-        self.__tohil_import_namespace__(namespace)
-        # print(f"{self} done importing namespace '{namespace}'")
+
+        # python attribute name to (tcl name, is it a namespace), read
+        # from tcl the first time an attribute needs to be resolved
+        self.__tohil_names__ = None
+
+        if prefetch is not None:
+            self.__tohil_prefetch__(*prefetch)
+
+    def __repr__(self):
+        """repr function"""
+        return f"<class 'TclNamespace' '{self.__tohil_namespace__}'>"
+
+    def __tohil_load_names__(self):
+        """read the names of the namespace's commands and children from tcl
+        and map them from the python attribute names they'll be imported as"""
+        names = dict()
+        namespace = self.__tohil_namespace__
+
+        for proc in info_commands(namespace + "::*"):
+            # NB this excluder stuff is a little clumsy, but if it was
+            # in the TclProc init routine then wouldn't that routine
+            # have to raise an exception if it didn't want the thing created?
+            if proc.startswith("::tcl::mathop::"):
+                continue
+            if doublecolon_tail(proc) in TclNamespace.proc_excluder:
+                continue
+            names[_proc_to_function(proc)] = (proc, False)
+
+        # child namespaces win over procs with the same name
+        for child in namespace_children(namespace):
+            names[doublecolon_tail(child)] = (child, True)
+
+        self.__tohil_names__ = names
+        return names
+
+    def __tohil_resolve__(self, name):
+        """import the proc or child namespace that attribute "name"
+        corresponds to, store it as an attribute and return it, or
+        return None if there isn't one"""
+        names = self.__tohil_names__
+        if names is None or name not in names:
+            # the namespace may have changed since we last looked
+            names = self.__tohil_load_names__()
+        if name not in names:
+            return None
+
+        tcl_name, is_namespace = names[name]
+        if is_namespace:
+            value = TclNamespace(tcl_name)
+            self.__tohil_namespaces__[name] = value
+            self.__setattr__(name, value)
+        else:
+            value = self.__tohil_import_proc__(tcl_name)
+        return value
+
+    def __getattr__(self, name):
+        """called only when name isn't already an attribute, to import
+        the proc or namespace it corresponds to"""
+        if name.startswith("__") and name.endswith("__"):
+            raise AttributeError(name)
+
+        try:
+            value = self.__tohil_resolve__(name)
+        except NameError as e:
+            # the command went away after we listed the namespace
+            raise AttributeError(str(e)) from e
+        if value is None:
+            raise AttributeError(
+                f"tcl namespace '{self.__tohil_namespace__}' has no proc, command or child namespace '{name}'"
+            )
+        return value
+
+    def __dir__(self):
+        """list the procs and namespaces that can be imported, as well
+        as whatever attributes we already have"""
+        names = self.__tohil_names__
+        if names is None:
+            names = self.__tohil_load_names__()
+        return sorted(set(super().__dir__()) | set(names))
+
+    def __tohil_prefetch__(self, *names):
+        """import the named procs and child namespaces now, rather than on first
+        use.  dotted names reach into child namespaces, like "msgcat.mc".
+        raises AttributeError for names that don't exist.  it's a dunder
+        so it can't hide a tcl proc named prefetch."""
+        for name in names:
+            target = self
+            for part in name.split("."):
+                target = getattr(target, part)
 
     def __tohil_import_proc__(self, proc):
         """create a callable TclProc object corresponding to "proc",
@@ -612,55 +611,15 @@ class TclNamespace:
         # argument and will be the tclproc object ergo we can get to the
         # trampoline and other stuff about the proc like its arguments,
         # defaults, etc, because self is us.
-        self.__setattr__(
-            tclproc.function_name,
-            tclproc
-            # tclproc.function_name, types.MethodType(tclproc, tclproc)
-        )
-
-    def __tohil_import_procs__(self, pattern=None):
-        """import all the procs commands in one namespace"""
-        # print(f"    importing procs pattern '{pattern}', '{info_commands(pattern)}'")
-        for proc in info_commands(pattern):
-            # NB this excluder stuff is a little clumsy, but if it was
-            # in the TclProc init routine then wouldn't that routine
-            # have to raise an exception if it didn't want the thing created?
-            if proc.startswith("::tcl::mathop::"):
-                continue
-            if doublecolon_tail(proc) in TclNamespace.proc_excluder:
-                continue
-            try:
-                self.__tohil_import_proc__(proc)
-            except Exception as exception:
-                # except NameError:
-                # DES::Pad has a null byte for a default argument
-                if proc != "::DES::Pad":
-                    print(
-                        f"failed to import proc '{proc}', exception '{exception}', continuing...",
-                        file=_sys.stderr,
-                    )
-        # print(f"    done importing procs pattern '{pattern}'")
-
-    def __tohil_import_namespace__(self, namespace="::"):
-        """import from a tcl namespace.  create a TclNamespace object
-        and import all the procs into it and return it
-
-        and import all the subordinate namespaces into them as well"""
-
-        self.__tohil_import_procs__(namespace + "::*")
-
-        for child in namespace_children(namespace):
-            # print(f"  importing child namespace {child}")
-            new_namespace = TclNamespace(child)
-
-            child_short = doublecolon_tail(child)
-            # print(f"  {self} storing child {child_short} namespace {new_namespace}")
-            self.__setattr__(child_short, new_namespace)
+        self.__setattr__(tclproc.function_name, tclproc)
+        return tclproc
 
 
-def import_tcl():
-    """recursively import all tcl namespaces and functions"""
-    return TclNamespace("")
+def import_tcl(prefetch=None):
+    """return a TclNamespace for the global namespace, through which
+    all tcl namespaces and functions can be reached.  they're imported
+    as they're used, or up front if named in prefetch."""
+    return TclNamespace("", prefetch=prefetch)
 
 def tcl_stdout_to_python():
     """redirect tcl's stdout to python"""
@@ -63,6 +63,84 @@ class TestCall(unittest.TestCase):
     def test_call8(self):
         self.assertEqual(two_arg_kw(42, 77, foo="bar"), ("42", "77", "{'foo': 'bar'}"))
 
+    def test_call9(self):
+        """tohil.call with more arguments than fit in its stack objv"""
+        args = [str(i) for i in range(40)]
+        self.assertEqual(tohil.call("list", *args, to=list), args)
+        self.assertEqual(tohil.call("llength", args, to=int), 40)
+
+    def test_call10(self):
+        """keyword and positional argument handling"""
+        self.assertEqual(tohil.eval(tcl_code="expr 6 * 7", to=int), 42)
+        self.assertEqual(tohil.expr(expression="6 * 7", to=int), 42)
+        with self.assertRaises(TypeError):
+            tohil.eval()
+        with self.assertRaises(TypeError):
+            tohil.eval("expr 1", int)
+        with self.assertRaises(TypeError):
+            tohil.eval("expr 1", tcl_code="expr 2")
+        with self.assertRaises(TypeError):
+            tohil.eval("expr 1", nonesuch=1)
+        with self.assertRaises(TypeError):
+            tohil.eval(42)
+        with self.assertRaises(ValueError):
+            tohil.eval("return a\0b")
+
+    def test_call_many1(self):
+        """tohil.call_many runs commands and collects results"""
+        self.assertEqual(tohil.call_many([("expr", "1 + 1"), ["string", "toupper", "abc"]], to=str), ["2", "ABC"])
+        self.assertEqual(tohil.call_many((("set", "call_many_x", i) for i in range(5)), to=int), [0, 1, 2, 3, 4])
+        self.assertEqual(tohil.getvar("call_many_x", to=int), 4)
+        self.assertEqual(tohil.call_many([], to=int), [])
+        args = [str(i) for i in range(40)]
+        self.assertEqual(tohil.call_many([("list", "a"), ["list", *args], ("list", "b")], to=list), [["a"], args, ["b"]])
+
+    def test_call_many2(self):
+        """tohil.call_many errors"""
+        results = tohil.call_many([("expr", "1"), ("error", "oops"), ("expr", "2"), ("expr", "x")], to=int)
+        self.assertEqual(results[0], 1)
+        self.assertIsInstance(results[1], tohil.TclError)
+        self.assertEqual(results[1].result, "oops")
+        self.assertEqual(results[2], 2)
+        self.assertIsInstance(results[3], tohil.TclError)
+
+        tohil.setvar("call_many_y", 0)
+        with self.assertRaises(tohil.TclError):
+            tohil.call_many([("incr", "call_many_y"), ("error", "oops"), ("incr", "call_many_y")], stop_on_error=True)
+        self.assertEqual(tohil.getvar("call_many_y", to=int), 1)
+
+        self.assertIsInstance(tohil.call_many(["set x 1"])[0], TypeError)
+        with self.assertRaises(TypeError):
+            tohil.call_many([42], stop_on_error=True)
+        with self.assertRaises(TypeError):
+            tohil.call_many(42)
+
+    def test_call_many3(self):
+        """tohil.call_many works from copies of the commands and their arguments"""
+
+        class Clearing:
+            def __init__(self, *lists):
+                self.lists = lists
+
+            def __str__(self):
+                for l in self.lists:
+                    l.clear()
+                return "cleared"
+
+        row = ["list", "a"]
+        commands = [row, ["list", "b", "c"], ("list", "d")]
+        row.insert(1, Clearing(commands, row))
+        self.assertEqual(tohil.call_many(commands, to=list), [["cleared", "a"], ["b", "c"], ["d"]])
+        self.assertEqual(commands, [])
+
+        commands = [("list", "e"), ["list", "f"]]
+
+        def clearing_to(value):
+            commands.clear()
+            return str(value)
+
+        self.assertEqual(tohil.call_many(commands, to=clearing_to), ["e", "f"])
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -1,7 +1,10 @@
 
+import array
 import hypothesis
 from hypothesis import given, assume, strategies as st
 from string import printable
+import sys
+import typing
 import unittest
 
 import tohil
@@ -60,6 +63,378 @@ class TestMethods(unittest.TestCase):
             repr(tohil.convert("1 2 3", to=tohil.tclobj)) == "<tohil.tclobj: '1 2 3'>"
         )
 
+    def test_convert9(self):
+        """strings that need transcoding survive the trip through tcl"""
+        for s in ["plain ascii", "a\x00b", "caf\u00e9", "\U0001f600 smile", "x" * 5000 + "\U0001f4a9", "\x00" * 9]:
+            assert(tohil.convert(s) == s)
+            tohil.setvar("convert9", s)
+            assert(tohil.eval("set convert9") == s)
+            if max(s) < "\U00010000":
+                # tcl 8.6 counts characters outside the BMP as surrogate pairs
+                assert(tohil.call("string", "length", s, to=int) == len(s))
+            assert(str(tohil.tclobj(s)) == s)
+
+    @given(st.lists(st.text()))
+    def test_convert10(self, ilist):
+        """arbitrary unicode round trips through list, tuple and dict conversions"""
+        assert(tohil.convert(ilist, to=list) == ilist)
+        assert(tohil.convert(tuple(ilist), to=tuple) == tuple(ilist))
+        idict = {k: k[::-1] for k in ilist}
+        assert(tohil.convert(idict, to=dict) == idict)
+
+    def test_convert11(self):
+        """nested containers convert without recursion, up to the depth limit"""
+        assert(tohil.convert([1, [2, (3, {"a": [4, 5]})], {6}], to=list) == ["1", "2 {3 {a {4 5}}}", "6"])
+        assert(tohil.convert({"k": {"j": [1, 2]}, (1, 2): "v"}) == "k {j {1 2}} {1 2} v")
+
+        limit = tohil.get_conversion_depth_limit()
+        try:
+            deep = "x"
+            for i in range(100000):
+                deep = [deep]
+            tohil.set_conversion_depth_limit(200000)
+            assert(tohil.call("llength", deep, to=int) == 1)
+
+            tohil.set_conversion_depth_limit(10)
+            with self.assertRaises(RecursionError):
+                tohil.convert(deep)
+            nine = "x"
+            for i in range(9):
+                nine = [nine]
+            assert(tohil.call("llength", nine, to=int) == 1)
+        finally:
+            tohil.set_conversion_depth_limit(limit)
+
+        with self.assertRaises(ValueError):
+            tohil.set_conversion_depth_limit(0)
+
+    def test_convert12(self):
+        """self-referential containers raise instead of crashing"""
+        l = [1]
+        l.append(l)
+        with self.assertRaises(RecursionError):
+            tohil.convert(l)
+        d = {}
+        d["me"] = d
+        with self.assertRaises(RecursionError):
+            tohil.setvar("convert12", d)
+        with self.assertRaises(RecursionError):
+            tohil.call("list", l)
+        with self.assertRaises(RecursionError):
+            tohil.tclobj(l)
+
+    def test_convert13(self):
+        """exact lists, tuples and dicts convert like their subclasses"""
+        class sublist(list):
+            pass
+
+        class subtuple(tuple):
+            pass
+
+        class subdict(dict):
+            pass
+
+        assert(tohil.convert([1, "a b", (2, 3)]) == tohil.convert(sublist([1, "a b", subtuple((2, 3))])))
+        assert(tohil.convert({"a": 1, "b c": [2, 3]}) == tohil.convert(subdict({"a": 1, "b c": [2, 3]})))
+        assert(tohil.convert((), to=list) == [])
+        assert(tohil.convert({}, to=dict) == {})
+        assert(tohil.convert(frozenset(), to=str) == "frozenset()")
+
+        d = {"a": 1}
+
+        class grower:
+            def __str__(self):
+                d["more"] = 1
+                return "grower"
+
+        d["b"] = grower()
+        with self.assertRaises(RuntimeError):
+            tohil.convert(d)
+
+        l = [1, 2]
+
+        class shrinker:
+            def __str__(self):
+                l.clear()
+                return "shrinker"
+
+        l.append(shrinker())
+        l.append(3)
+        assert(tohil.convert(l, to=list) == ["1", "2", "shrinker"])
+
+    def test_convert14(self):
+        """to= generic aliases convert the elements too"""
+        assert(tohil.eval("list 1 2 3", to=list[int]) == [1, 2, 3])
+        assert(tohil.eval("list 1 2 3", to=typing.List[float]) == [1.0, 2.0, 3.0])
+        assert(tohil.eval("list 1 0 1", to=set[bool]) == {True, False})
+        assert(tohil.eval("list a 1.5 b 2", to=dict[str, float]) == {"a": 1.5, "b": 2.0})
+        assert(tohil.eval("list 1 a 2.5", to=tuple[int, str, float]) == (1, "a", 2.5))
+        assert(tohil.eval("list 1 2 3", to=tuple[int, ...]) == (1, 2, 3))
+        assert(tohil.eval("list", to=tuple[()]) == ())
+        assert(tohil.eval("list a {1 2} b {}", to=dict[str, list[int]]) == {"a": [1, 2], "b": []})
+        assert(tohil.eval("list {a 1} {b 2}", to=list[typing.Tuple[str, int]]) == [("a", 1), ("b", 2)])
+        assert(tohil.eval("list {a b} {c}", to=list[list]) == [["a", "b"], ["c"]])
+
+        t = tohil.tclobj([["1", "2"], ["3"]], to=list[int])
+        assert(t[0] == [1, 2])
+        assert(tohil.convert("4 5", to=lambda x: list(x)) == [tohil.tclobj("4"), tohil.tclobj("5")])
+
+        with self.assertRaises(ValueError):
+            tohil.eval("list 1 a 3", to=list[int])
+        with self.assertRaises(ValueError):
+            tohil.eval("list 1 2", to=tuple[int, int, int])
+        with self.assertRaises(TypeError):
+            tohil.eval("list a 1 b", to=dict[str, int])
+        with self.assertRaises(TypeError):
+            tohil.eval("list 1", to=typing.Optional[int])
+
+    def test_convert15(self):
+        """to=tohil.auto converts by what tcl knows the object to be"""
+        assert(tohil.eval("expr {1 + 2}", to=tohil.auto) == 3)
+        assert(type(tohil.eval("expr {1 + 2}", to=tohil.auto)) == int)
+        assert(tohil.eval("expr {2 ** 70}", to=tohil.auto) == 2 ** 70)
+        assert(tohil.eval("expr {1.5 * 2}", to=tohil.auto) == 3.0)
+        assert(tohil.eval("binary format a3 abc", to=tohil.auto) == b"abc")
+        assert(tohil.eval("list a [expr {2.5}] x", to=tohil.auto) == ["a", 2.5, "x"])
+        assert(tohil.eval("dict create a [expr {1}] b [list [expr {2}] c]", to=tohil.auto) == {"a": 1, "b": [2, "c"]})
+
+        # strings that look like numbers aren't parsed, or shimmered
+        assert(tohil.eval("return 42", to=tohil.auto) == "42")
+        tohil.eval("set auto_s 42")
+        tohil.call("set", "auto_s", to=tohil.auto)
+        assert(tohil.eval("tcl::unsupported::representation $auto_s", to=str).startswith("value is a pure string"))
+
+        assert(tohil.eval("set auto_b yes; if {$auto_b} {}; return $auto_b", to=tohil.auto) is True)
+        assert(tohil.auto(5) == 5)
+        assert(tohil.auto([1, 2.5, "x"]) == [1, 2.5, "x"])
+        assert(tohil.auto({"a": [1, b"z"]}) == {"a": [1, b"z"]})
+
+        t = tohil.tclobj([1, "a"], to=tohil.auto)
+        assert(t.to is tohil.auto)
+        assert(t[0] == 1)
+        assert(t[1] == "a")
+
+        # nesting deeper than python's recursion limit is an error, not a crash
+        tohil.eval("set auto_deep [list 1]; for {set i 0} {$i < 100000} {incr i} {set auto_deep [list $auto_deep 1]}")
+        with self.assertRaises(RecursionError):
+            tohil.getvar("auto_deep", to=tohil.auto)
+        tohil.eval("set auto_deep [list 1]; for {set i 0} {$i < 50} {incr i} {set auto_deep [list $auto_deep]}")
+        deep = tohil.getvar("auto_deep", to=tohil.auto)
+        for i in range(50):
+            deep = deep[0]
+        assert(deep == ["1"])
+        tohil.eval("unset auto_deep")
+
+    def test_convert16(self):
+        """objects with the buffer protocol convert straight from their memory"""
+        assert(tohil.convert(array.array("d", [1.5, -2.0]), to=list[float]) == [1.5, -2.0])
+        assert(tohil.convert(array.array("q", [1, -2, 2 ** 40]), to=list[int]) == [1, -2, 2 ** 40])
+        assert(tohil.convert(array.array("Q", [2 ** 64 - 1]), to=str) == str(2 ** 64 - 1))
+        assert(tohil.convert(array.array("h", [-7]), to=tohil.auto) == [-7])
+        assert(tohil.convert(array.array("f", [0.5]), to=tohil.auto) == [0.5])
+        assert(tohil.convert(array.array("i"), to=list) == [])
+        assert(tohil.convert(memoryview(array.array("l", [3, 4])), to=list[int]) == [3, 4])
+
+        assert(tohil.convert(bytearray(b"a\x00b"), to=tohil.auto) == b"a\x00b")
+        assert(tohil.convert(memoryview(b"xyz")[1:], to=tohil.auto) == b"yz")
+        assert(tohil.call("string", "length", bytearray(range(256)), to=int) == 256)
+
+        # 0-dimensional buffers are single numbers, even unsigned bytes
+        assert(tohil.convert(memoryview(b"\x05").cast("B", shape=[]), to=tohil.auto) == 5)
+        assert(tohil.convert(memoryview(array.array("d", [2.5])).cast("B").cast("d", shape=[]), to=tohil.auto) == 2.5)
+
+        # n-dimensional byte buffers aren't flattened into one byte
+        # array.  memoryviews of them can't be iterated, so that's an error
+        with self.assertRaises(NotImplementedError):
+            tohil.convert(memoryview(b"abcd").cast("B", shape=[2, 2]))
+
+        # unsigned 64-bit values past the top of a wide int are bignums
+        assert(tohil.convert(array.array("Q", [2 ** 64 - 1, 1]), to=tohil.auto) == [2 ** 64 - 1, 1])
+
+        # non-contiguous views fall back to the sequence protocol
+        assert(tohil.convert(memoryview(array.array("i", [1, 2, 3, 4]))[::2], to=list[int]) == [1, 3])
+
+        # so do formats whose size may not be the native one, like
+        # ctypes arrays with their byte order prefix
+        import ctypes
+        assert(tohil.convert((ctypes.c_long * 3)(1, -2, 3), to=list[int]) == [1, -2, 3])
+        assert(tohil.convert((ctypes.c_short * 2)(5, -6), to=tohil.auto) == [5, -6])
+
+        t = tohil.tclobj([1.25, 2.5]).to_array("d")
+        assert(tohil.convert(t, to=list[float]) == [1.25, 2.5])
+
+    def test_convert17(self):
+        """dict keys converted from tcl are shared, interned strs"""
+        d1 = tohil.eval("list name alice uid 1", to=dict)
+        d2 = tohil.eval("dict create name bob uid 2", to=dict)
+        k1 = sorted(d1, key=str)
+        k2 = sorted(d2, key=str)
+        assert(k1 == ["name", "uid"])
+        assert(all(a is b for a, b in zip(k1, k2)))
+        assert(k1[0] is sys.intern("name"))
+
+        d4 = tohil.eval("list name dave", to=dict[str, str])
+        assert(next(iter(d4)) is k1[0])
+        assert(next(iter(tohil.tcldict("name x"))) is k1[0])
+
+        # long keys aren't cached but still convert
+        long_key = "k" * 200
+        assert(tohil.eval(f"list {long_key} 1", to=dict[str, int]) == {long_key: 1})
+
+    def test_convert18(self):
+        """strs that round trip through tcl unchanged come back identical"""
+        s = "identifier \u00e9 " + "x" * 20
+        tohil.call("set", "rt_s", s)
+        assert(tohil.getvar("rt_s", to=str) is s)
+        assert(tohil.call("return", s, to=str) is s)
+
+        # changing the tcl string drops the remembered str
+        tohil.eval("append rt_s y")
+        assert(tohil.getvar("rt_s", to=str) == s + "y")
+        tohil.eval("set rt_s [string range $rt_s 0 end-1]")
+        assert(tohil.getvar("rt_s", to=str) == s)
+        assert(tohil.getvar("rt_s", to=str) is not s)
+
+        # converting the same tcl object again gives the same str
+        tohil.eval("set rt_t [string repeat ab 3]")
+        first = tohil.getvar("rt_t", to=str)
+        assert(first == "ababab")
+        assert(tohil.getvar("rt_t", to=str) is first)
+
+        t = tohil.tclobj(["a b", "c"], to=str)
+        assert(all(a is b for a, b in zip(list(t), list(t))))
+
+        # long tcl strings don't keep a second copy of themselves as a str
+        tohil.eval("set rt_l [string repeat ab 10000]")
+        first = tohil.getvar("rt_l", to=str)
+        assert(first == "ab" * 10000)
+        assert(tohil.getvar("rt_l", to=str) is not first)
+        assert(tohil.eval("tcl::unsupported::representation $rt_l", to=str).startswith("value is a pure string"))
+
+        # but long strs from python are remembered, as python has them anyway
+        long_s = "cd" * 10000
+        tohil.call("set", "rt_l", long_s)
+        assert(tohil.getvar("rt_l", to=str) is long_s)
+
+        # strs that need transcoding, and str subclasses
+        u = "a\x00b\U0001F600"
+        tohil.call("set", "rt_u", u)
+        assert(tohil.getvar("rt_u", to=str) is u)
+        assert(tohil.eval("string length $rt_u", to=int) == 5)
+
+        class S(str):
+            pass
+
+        tohil.call("set", "rt_v", S("v"))
+        assert(type(tohil.getvar("rt_v", to=str)) is str)
+
+    def test_convert19(self):
+        """ints too big for a wide int cross as tcl bignums"""
+        for n in [2 ** 63, -2 ** 63 - 1, 2 ** 64 - 1, 2 ** 127 + 12345, -(2 ** 128), 3 ** 200, -(7 ** 500), 2 ** 4096 - 1]:
+            assert(tohil.convert(n, to=int) == n)
+            tohil.call("set", "big", n)
+            assert(tohil.eval("string is entier $big", to=bool))
+            assert(tohil.eval("set big", to=str) == str(n))
+            assert(tohil.eval("expr {$big + 1}", to=int) == n + 1)
+            assert(tohil.eval("expr {$big * -3}", to=tohil.auto) == n * -3)
+            assert(int(tohil.tclobj(n)) == n)
+
+        assert(tohil.eval("expr {2 ** 200}", to=int) == 2 ** 200)
+        assert(int(tohil.eval("expr {-(2 ** 100) - 1}")) == -(2 ** 100) - 1)
+        assert(tohil.convert(2 ** 64, to=int) == 2 ** 64)
+        with self.assertRaises(ValueError):
+            tohil.eval("return 1.5", to=int)
+
+    def test_convert20(self):
+        """registered converters convert python types to tcl"""
+        import dataclasses
+        import decimal
+        import enum
+
+        class Color(enum.Enum):
+            RED = 1
+
+        class Size(enum.IntEnum):
+            BIG = 10
+
+        @dataclasses.dataclass
+        class Point:
+            x: int
+            y: int
+
+        assert(tohil.convert(decimal.Decimal("1.25")) == "1.25")
+        assert(tohil.convert(Color.RED) == "Color.RED")
+
+        tohil.register_converter(decimal.Decimal, float)
+        tohil.register_converter(enum.Enum, lambda e: e.name)
+        tohil.register_converter(Point, dataclasses.astuple)
+        try:
+            assert(tohil.convert(decimal.Decimal("1.25"), to=tohil.auto) == 1.25)
+            assert(tohil.convert(Color.RED) == "RED")
+            assert(tohil.convert(Size.BIG) == "BIG")
+            assert(tohil.convert([Point(1, 2), Point(3, 4)], to=list[tuple[int, int]]) == [(1, 2), (3, 4)])
+
+            tohil.register_converter(Point, lambda p: tohil.tclobj([p.y, p.x]))
+            assert(tohil.convert(Point(1, 2), to=list[int]) == [2, 1])
+
+            tohil.register_converter(Point, lambda p: p)
+            with self.assertRaises(RecursionError):
+                tohil.convert(Point(1, 2))
+
+            tohil.register_converter(Point, lambda p: 1 / 0)
+            with self.assertRaises(ZeroDivisionError):
+                tohil.call("list", Point(1, 2))
+        finally:
+            tohil.register_converter(decimal.Decimal, None)
+            tohil.register_converter(enum.Enum, None)
+            tohil.register_converter(Point, None)
+
+        assert(tohil.convert(decimal.Decimal("1.25")) == "1.25")
+        assert(tohil.convert(Size.BIG, to=int) == 10)
+        tohil.register_converter(Point, None)
+
+        with self.assertRaises(TypeError):
+            tohil.register_converter(int, str)
+        with self.assertRaises(TypeError):
+            tohil.register_converter("int", str)
+        with self.assertRaises(TypeError):
+            tohil.register_converter(Point, 5)
+
+        # a type that gains the sequence protocol converts as a list
+        class Grows:
+            def __str__(self):
+                return "grows"
+
+        assert(tohil.convert(Grows()) == "grows")
+        Grows.__len__ = lambda self: 2
+        Grows.__getitem__ = lambda self, i: [5, 6][i]
+        assert(tohil.convert(Grows(), to=list[int]) == [5, 6])
+
+    def test_convert21(self):
+        """callable element types can run tcl code that disturbs the list"""
+        tohil.eval("set ::conv21 {}; for {set i 0} {$i < 200000} {incr i} {lappend ::conv21 $i}")
+
+        # after the first element, free the list's element array if
+        # we're converting from it, and reuse the memory
+        def disturb(script):
+            def convert(t):
+                if not seen:
+                    tohil.eval(script)
+                    tohil.eval("set ::conv21_junk [lrepeat 200000 junk]")
+                seen.append(t)
+                return str(t)
+            seen = []
+            return convert
+
+        # replaces the interpreter result the list came from
+        l = tohil.eval("lrange $::conv21 1 end", to=list[disturb("set ::conv21_scratch 1")])
+        assert(len(l) == 199999 and l[-1] == "199999")
+
+        # uses the list itself as a dict
+        l = tohil.eval("set ::conv21", to=tuple[disturb("dict size $::conv21"), ...])
+        assert(len(l) == 200000 and l[-1] == "199999")
+        tohil.eval("unset ::conv21 ::conv21_junk ::conv21_scratch")
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -68,6 +68,25 @@ class TestEval(unittest.TestCase):
         with self.assertRaises(TypeError):
             tohil.eval("list 1 2 3", to=filter_minus_1)
 
+    def test_eval11(self):
+        """repeated tohil.eval and tohil.expr of the same string see new values"""
+        for i in range(5):
+            tohil.setvar("eval11", i)
+            self.assertEqual(tohil.eval("expr {$eval11 * 2}", to=int), i * 2)
+            self.assertEqual(tohil.expr("$eval11 + 1", to=int), i + 1)
+
+    def test_eval12(self):
+        """scripts still work after being pushed out of the script cache"""
+        for i in range(300):
+            self.assertEqual(tohil.eval(f"expr {{{i} + 1}}", to=int), i + 1)
+        self.assertEqual(tohil.eval("expr {0 + 1}", to=int), 1)
+
+    def test_eval13(self):
+        """a script that evaluates itself again through python"""
+        script = "incr eval13; if {$eval13 < 3} {tohil::call tohil.eval $eval13_script}; set eval13"
+        tohil.setvar("eval13", 0)
+        tohil.setvar("eval13_script", script)
+        self.assertEqual(tohil.eval(script, to=int), 3)
 
 if __name__ == "__main__":
     unittest.main()
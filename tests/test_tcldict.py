@@ -56,6 +56,42 @@ class TestTcleDict(unittest.TestCase):
 
         self.assertEqual(d[['m', 'j']], 'j1')
 
+    def test_tcldict5(self):
+        """conversion errors in tcldict and tclobj operations propagate"""
+        deep = "x"
+        for i in range(20):
+            deep = (deep,)
+
+        d = tohil.tcldict("a 1")
+        t = tohil.tclobj("abc")
+        limit = tohil.get_conversion_depth_limit()
+        try:
+            tohil.set_conversion_depth_limit(10)
+            with self.assertRaises(RecursionError):
+                d[deep] = "v"
+            with self.assertRaises(RecursionError):
+                d["b"] = deep
+            with self.assertRaises(RecursionError):
+                del d[deep]
+            with self.assertRaises(RecursionError):
+                t + deep
+            with self.assertRaises(RecursionError):
+                t += deep
+        finally:
+            tohil.set_conversion_depth_limit(limit)
+        self.assertEqual(str(d), "a 1")
+        self.assertEqual(str(t), "abc")
+
+        # keys and values that are other tclobjs' objects stay theirs
+        k = tohil.tclobj("key")
+        v = tohil.tclobj("value")
+        d[k] = v
+        d[["n", k]] = v
+        self.assertEqual(d[["n", "key"]], "value")
+        del d[k]
+        self.assertEqual(str(k), "key")
+        self.assertEqual(str(v), "value")
+        self.assertEqual(t + k, "abckey")
 
 
 if __name__ == "__main__":
@@ -263,5 +263,293 @@ class TestTclObj(unittest.TestCase):
             # hashable and so cannot be keys
             dict(tohil.tclobj("{1 2}"))
 
+    def test_tclobj26(self):
+        """to= applies to iteration, and is matched by type not name"""
+        x = tohil.tclobj([1, 2, 3], to=int)
+        self.assertEqual(list(x), [1, 2, 3])
+        self.assertEqual([v for v in x], [1, 2, 3])
+        x.to = float
+        self.assertEqual(list(x), [1.0, 2.0, 3.0])
+        it = iter(x)
+        self.assertEqual(list(it), [1.0, 2.0, 3.0])
+        self.assertEqual(list(it), [])
+        x.to = tohil.tclobj
+        self.assertIsInstance(next(iter(x)), tohil.tclobj)
+
+        # a class that happens to be named int isn't int
+        def init(self, value):
+            self.value = str(value)
+
+        not_int = type("int", (), {"__init__": init})
+        self.assertEqual(tohil.convert(5, to=not_int).value, "5")
+
+        # slicing applies to, too
+        x.to = int
+        self.assertEqual(x[0:2], [1, 2])
+
+    def test_tclobj27(self):
+        """tclobj.to_array packs a list of numbers into an array.array"""
+        import array
+
+        t = tohil.eval("list 1 2.5 -3 [expr {4}]")
+        a = t.to_array()
+        self.assertEqual(a, array.array("d", [1.0, 2.5, -3.0, 4.0]))
+        self.assertEqual(memoryview(a).format, "d")
+        self.assertEqual(t.to_array("f"), array.array("f", [1.0, 2.5, -3.0, 4.0]))
+
+        t = tohil.tclobj([1, -2, 300])
+        self.assertEqual(t.to_array("q"), array.array("q", [1, -2, 300]))
+        self.assertEqual(t.to_array("h"), array.array("h", [1, -2, 300]))
+        self.assertEqual(tohil.tclobj([]).to_array("i"), array.array("i"))
+        with self.assertRaises(OverflowError):
+            t.to_array("b")
+        with self.assertRaises(OverflowError):
+            t.to_array(typecode="H")
+        with self.assertRaises(ValueError):
+            tohil.tclobj([1, 2.5]).to_array("i")
+        with self.assertRaises(ValueError):
+            tohil.tclobj(["a"]).to_array()
+        with self.assertRaises(ValueError):
+            t.to_array("u")
+        with self.assertRaises(TypeError):
+            tohil.tclobj("{").to_array()
+
+        # all of 'Q', and nothing past the ends of 'q'
+        big = [0, 2**63 - 1, 2**63, 2**64 - 1]
+        self.assertEqual(tohil.tclobj(big).to_array("Q"), array.array("Q", big))
+        self.assertEqual(tohil.tclobj([-2**63, 2**63 - 1]).to_array("q"), array.array("q", [-2**63, 2**63 - 1]))
+        for value, typecode in ((2**63, "q"), (2**64 - 1, "q"), (-2**63 - 1, "q"), (2**64, "Q"), (-1, "Q")):
+            with self.assertRaises(OverflowError):
+                tohil.tclobj([value]).to_array(typecode)
+
+    def test_tclobj28(self):
+        """tclobj buffer protocol exports the tcl byte array"""
+        import hashlib
+        import zlib
+
+        data = bytes(range(256)) * 4
+        t = tohil.tclobj(data)
+        self.assertEqual(bytes(t), data)
+        self.assertEqual(hashlib.sha256(t).digest(), hashlib.sha256(data).digest())
+        self.assertEqual(zlib.crc32(t), zlib.crc32(data))
+
+        m = memoryview(t)
+        self.assertTrue(m.readonly)
+        self.assertEqual(m.nbytes, len(data))
+        self.assertEqual(m[1:4], b"\x01\x02\x03")
+        with self.assertRaises(BufferError):
+            t.set(b"abc")
+        with self.assertRaises(BufferError):
+            t.append("x")
+        with self.assertRaises(BufferError):
+            t.clear()
+        self.assertEqual(m.tobytes(), data)
+        m.release()
+
+        t.set(b"abc")
+        self.assertEqual(bytes(t), b"abc")
+        with memoryview(t) as m2:
+            self.assertEqual(m2.tobytes(), b"abc")
+        t.clear()
+        self.assertEqual(bytes(t), b"")
+
+        # reading the tclobj as a list or a string while a view is live
+        # mustn't free the bytes the view is looking at
+        data = b"A" * 1000000
+        t = tohil.tclobj(data)
+        m = memoryview(t)
+        self.assertEqual(len(t), 1)
+        self.assertEqual(t[0], "A" * 1000000)
+        tohil.eval("set ::buf28_junk [lrepeat 200000 junk]")
+        self.assertEqual(m.tobytes(), data)
+        m.release()
+        self.assertEqual(bytes(t), data)
+
+        # likewise when tcl holds the object, or the tclobj is bound to a
+        # variable, and tcl reads it as a list
+        tohil.call("set", "::buf28", t)
+        m = memoryview(t)
+        self.assertEqual(tohil.eval("llength $::buf28", to=int), 1)
+        v = tohil.tclobj(var="::buf28")
+        with memoryview(v) as m2:
+            self.assertEqual(tohil.eval("llength $::buf28", to=int), 1)
+            self.assertEqual(len(v), 1)
+            tohil.eval("set ::buf28_junk [lrepeat 200000 junk]")
+            self.assertEqual(m2.tobytes(), data)
+        tohil.eval("set ::buf28_junk [lrepeat 200000 junk]")
+        self.assertEqual(m.tobytes(), data)
+        m.release()
+        tohil.eval("unset ::buf28 ::buf28_junk")
+
+    def test_tclobj29(self):
+        """tclobj.to_columns turns a list of dicts into a dict of columns"""
+        import array
+
+        t = tohil.eval("list {id 1 name alice score 2.5} {id 2 name bob score 4} {name carol id 3}")
+        c = t.to_columns()
+        self.assertEqual(c, {"id": ["1", "2", "3"], "name": ["alice", "bob", "carol"], "score": ["2.5", "4", None]})
+        self.assertEqual(list(c), ["id", "name", "score"])
+
+        c = t.to_columns(["name", "id"], {"id": int})
+        self.assertEqual(c, {"name": ["alice", "bob", "carol"], "id": [1, 2, 3]})
+        self.assertEqual(list(c), ["name", "id"])
+
+        c = t.to_columns(fields=["id"], types="q")
+        self.assertEqual(c, {"id": array.array("q", [1, 2, 3])})
+        c = t.to_columns(["id", "score"], {"id": "i", "score": float})
+        self.assertEqual(c, {"id": array.array("i", [1, 2, 3]), "score": [2.5, 4.0, None]})
+        c = t.to_columns(["id"], tohil.tclobj)
+        self.assertIsInstance(c["id"][0], tohil.tclobj)
+
+        self.assertEqual(tohil.tclobj([]).to_columns(), {})
+        self.assertEqual(tohil.tclobj([]).to_columns(["a"], "d"), {"a": array.array("d")})
+
+        with self.assertRaises(ValueError):
+            t.to_columns(["score"], "d")
+        with self.assertRaises(ValueError):
+            t.to_columns(["id"], "u")
+        with self.assertRaises(TypeError):
+            t.to_columns(["id"], {"id": 5})
+        with self.assertRaises(TypeError):
+            t.to_columns([1])
+        with self.assertRaises(TypeError):
+            tohil.eval("list {a 1} {b}").to_columns()
+        with self.assertRaises(ValueError):
+            t.to_columns(["name"], int)
+
+        # generic types, and to= callables that change the tclobj or use
+        # the rows as something else while they're being gathered
+        tohil.eval("set ::cols29 {}; for {set i 0} {$i < 20000} {incr i} {lappend ::cols29 [dict create id $i tags [list $i 7]]}")
+        t = tohil.getvar("::cols29", to=tohil.tclobj)
+        seen = []
+
+        def disturb(v):
+            if not seen:
+                t.set("x")
+                tohil.eval("foreach r $::cols29 {llength $r; string length [lindex $r 3]}; unset ::cols29")
+                tohil.eval("set ::cols29_junk [lrepeat 200000 junk]")
+            seen.append(v)
+            return int(v)
+
+        c = t.to_columns(["id", "tags"], {"id": disturb, "tags": list[int]})
+        self.assertEqual(c["id"], list(range(20000)))
+        self.assertEqual(c["tags"][0], [0, 7])
+        self.assertEqual(c["tags"][19999], [19999, 7])
+        self.assertEqual(len(seen), 20000)
+        self.assertEqual(str(t), "x")
+        tohil.eval("unset ::cols29_junk")
+
+    def test_tclobj30(self):
+        """tclobj.iter_chunks yields a list's elements a chunk at a time"""
+        t = tohil.eval("lrange {1 2 3 4 5 6 7} 0 end")
+        self.assertEqual(list(t.iter_chunks(3, to=int)), [[1, 2, 3], [4, 5, 6], [7]])
+        self.assertEqual(list(t.iter_chunks(7, to=int)), [[1, 2, 3, 4, 5, 6, 7]])
+        self.assertEqual(list(t.iter_chunks(100, to=str)), [["1", "2", "3", "4", "5", "6", "7"]])
+        self.assertEqual(list(tohil.tclobj([]).iter_chunks(2)), [])
+
+        chunks = list(t.iter_chunks(4))
+        self.assertIsInstance(chunks[0][0], tohil.tclobj)
+        t.to = float
+        self.assertEqual(next(t.iter_chunks(2)), [1.0, 2.0])
+
+        # the iterator works from the list as it was when it was made
+        i = t.iter_chunks(n=5, to=int)
+        t.append(8)
+        self.assertEqual(list(i), [[1, 2, 3, 4, 5], [6, 7]])
+        with self.assertRaises(StopIteration):
+            next(i)
+
+        with self.assertRaises(ValueError):
+            t.iter_chunks(0)
+        with self.assertRaises(TypeError):
+            t.iter_chunks("3")
+        with self.assertRaises(TypeError):
+            tohil.tclobj("{").iter_chunks(3)
+        with self.assertRaises(ValueError):
+            list(tohil.tclobj(["a"]).iter_chunks(3, to=int))
+
+        # a to= callable that uses the list as a dict mid-chunk.  the list is
+        # made at its exact size so the junk list reuses its memory if freed
+        tohil.eval("set ::chunks30 {}; for {set i 0} {$i < 20000} {incr i} {lappend ::chunks30 $i}; set ::chunks30 [list {*}$::chunks30]")
+        t = tohil.getvar("::chunks30", to=tohil.tclobj)
+
+        def disturb(v):
+            tohil.eval("dict size $::chunks30")
+            if v == "5":
+                tohil.eval("set ::chunks30_junk [lrepeat 20000 junk]")
+            return int(v)
+
+        chunks = list(t.iter_chunks(10000, to=disturb))
+        self.assertEqual(chunks, [list(range(10000)), list(range(10000, 20000))])
+        tohil.eval("unset ::chunks30 ::chunks30_junk")
+
+    def test_tclobj31(self):
+        """frozentclobjs hash by their string rep and are immutable"""
+        # tclobjs are mutable, so they aren't hashable
+        with self.assertRaises(TypeError):
+            hash(tohil.tclobj("hello"))
+        with self.assertRaises(TypeError):
+            hash(tohil.tcldict())
+
+        f = tohil.frozentclobj("hello")
+        self.assertEqual(hash(f), hash("hello"))
+        self.assertEqual(hash(tohil.frozentclobj("")), hash(""))
+        self.assertEqual(hash(tohil.frozentclobj("h\u00e9llo \u4e16\u754c")), hash("h\u00e9llo \u4e16\u754c"))
+        self.assertEqual(hash(tohil.frozentclobj([1, 2])), hash("1 2"))
+        self.assertIn(f, {"hello"})
+        self.assertIn("hello", {f})
+        self.assertEqual({tohil.frozentclobj("a"): 1}[tohil.frozentclobj("a")], 1)
+
+        # frozentclobjs only equal strs and tclobjs, by string, so they
+        # find the strs they equal, even ones that look like numbers
+        self.assertEqual({"1.0": 1}.get(tohil.frozentclobj("1.0")), 1)
+        self.assertEqual({"12345": "id"}[tohil.frozentclobj(12345)], "id")
+        self.assertNotEqual(tohil.frozentclobj(1), 1)
+        self.assertNotEqual(1.0, tohil.frozentclobj("1.0"))
+        self.assertNotIn(tohil.frozentclobj(1), {1})
+        self.assertEqual(tohil.frozentclobj(1), tohil.tclobj("1"))
+        self.assertEqual(tohil.tclobj("1"), tohil.frozentclobj(1))
+        s = {"1", "1.0", 1, 1.0, 2**70, tohil.frozentclobj(1), tohil.frozentclobj("1.0"),
+             tohil.frozentclobj(2**70), tohil.frozentclobj("x"), "x"}
+        self.assertEqual(len(s), 6)
+        for a in s:
+            for b in s:
+                if a == b:
+                    self.assertEqual(hash(a), hash(b))
+
+        f = tohil.frozentclobj([1, 2, 3])
+        self.assertIsInstance(f, tohil.tclobj)
+        self.assertEqual(f, "1 2 3")
+        self.assertEqual(hash(f), hash("1 2 3"))
+        self.assertEqual(list(f), ["1", "2", "3"])
+        self.assertEqual(len(f), 3)
+        self.assertEqual(f[1], "2")
+        self.assertEqual(int(tohil.frozentclobj(5)) + 1, 6)
+        for mutate in (lambda: f.append(4), lambda: f.set(1), f.clear,
+                       lambda: f.pop(), lambda: f.__setitem__(0, 9)):
+            with self.assertRaises(TypeError):
+                mutate()
+        with self.assertRaises(AttributeError):
+            f.to = int
+        tohil.eval("set hashvar abc")
+        with self.assertRaises(TypeError):
+            tohil.frozentclobj(var="hashvar")
+        self.assertEqual(f, "1 2 3")
+
+        # a frozentclobj made from a tclobj shares its tcl object, and
+        # writes to the tclobj don't show up in the frozentclobj
+        t = tohil.tclobj([1, 2])
+        f = tohil.frozentclobj(t)
+        t.append(3)
+        self.assertEqual(f, "1 2")
+        self.assertEqual(t, "1 2 3")
+
+        # dedup and grouping over tcl results without making strs
+        fs = tohil.eval("list x y x", to=tohil.frozentclobj)
+        self.assertIs(type(fs), tohil.frozentclobj)
+        self.assertEqual(fs, "x y x")
+        self.assertEqual(len(set(tohil.eval("list a b a c b a", to=list[tohil.frozentclobj]))), 3)
+        self.assertEqual(set(next(tohil.tclobj("x y x").iter_chunks(3, to=tohil.frozentclobj))), {"x", "y"})
+
 if __name__ == "__main__":
     unittest.main()
@@ -116,6 +116,144 @@ class TestTrampoline(unittest.TestCase):
         with self.assertRaises(NameError):
             t = tohil.TclProc("shenanigans")
 
+    def test_trampoline8(self):
+        """to= conversion, per call and by default"""
+        abc_test = tohil.TclProc("abc_test")
+        self.assertIsInstance(abc_test("a_val"), tohil.tclobj)
+        self.assertIsInstance(abc_test("a_val", to=str), str)
+
+        tohil.eval("proc add_test {a {b 1}} {expr {$a + $b}}")
+        add_test = tohil.TclProc("add_test", to=int)
+        self.assertEqual(add_test(5), 6)
+        self.assertEqual(add_test(5, b=2), 7)
+        self.assertEqual(add_test(5, to=str), "6")
+
+        add_test.to_type = float
+        self.assertEqual(add_test(1.5), 2.5)
+
+    def test_trampoline9(self):
+        """'args' gets leftover positional parameters, flattened"""
+        tohil.eval("proc args_test {a args} {return [list $a [llength $args] $args]}")
+        args_test = tohil.TclProc("args_test")
+        self.assertEqual(args_test("x", to=str), "x 0 {}")
+        self.assertEqual(args_test("x", "y", "z w", to=list), ["x", "2", "y {z w}"])
+        self.assertEqual(args_test(*range(40), to=list)[1], "39")
+        self.assertEqual(args_test(a="x", args=("y", "z"), to=list), ["x", "2", "y z"])
+
+        with self.assertRaises(TypeError):
+            args_test()
+
+    def test_trampoline10(self):
+        """C functions get their arguments passed through"""
+        lindex = tohil.TclProc("lindex")
+        self.assertEqual(lindex([1, 2, 3], 1, to=int), 2)
+        self.assertEqual(tohil.TclProc("list")(*range(30), to=list), [str(i) for i in range(30)])
+
+        with self.assertRaises(TypeError):
+            lindex([1, 2, 3], index=1)
+
+    def test_trampoline11(self):
+        """error messages"""
+        abc_test = tohil.TclProc("abc_test")
+
+        with self.assertRaisesRegex(TypeError, "named parameter 'd' is not a valid arument for proc 'abc_test'"):
+            abc_test("a", d="d")
+
+        with self.assertRaisesRegex(TypeError, "required arg 'a' missing"):
+            abc_test(b="b")
+
+        with self.assertRaisesRegex(TypeError, "too many arguments specified to be passed to tcl proc 'abc_test'"):
+            abc_test(1, 2, 3, 4)
+
+        tohil.eval("proc error_test {} {error oops}")
+        with self.assertRaises(tohil.TclError):
+            tohil.TclProc("error_test")()
+
+    def test_trampoline12(self):
+        """defaults are passed to tcl as they came from tcl"""
+        tohil.eval("proc default_test {{a {x {y z}}} {b \"\"}} {list [llength $a] [string length $b]}")
+        default_test = tohil.TclProc("default_test")
+        self.assertEqual(default_test(to=list), ["2", "0"])
+        self.assertEqual(default_test(b="bb", to=list), ["2", "2"])
+
+    def test_trampoline13(self):
+        """trampolines work from copies of argument lists python code can change"""
+
+        class Clearing:
+            def __init__(self, l):
+                self.l = l
+
+            def __str__(self):
+                self.l.clear()
+                return "cleared"
+
+        tohil.eval("proc clear_test {a args} {list $a {*}$args}")
+        clear_test = tohil.TclProc("clear_test")
+        extra = ["b", "c"]
+        extra.insert(0, Clearing(extra))
+        self.assertEqual(clear_test("a", args=extra, to=list), ["a", "cleared", "b", "c"])
+
+        names = ["x", "y", "z"]
+        t = tohil.trampoline("list", names, {"x": Clearing(names), "y": "yy", "z": "zz"})
+        self.assertEqual(t(to=list), ["cleared", "yy", "zz"])
+
+        with self.assertRaisesRegex(TypeError, "trampoline not initialized"):
+            tohil.trampoline.__new__(tohil.trampoline)()
+
+    def test_namespace1(self):
+        """namespaces import procs and children on first use"""
+        tohil.eval(
+            """namespace eval ::lazy_test {
+                proc hello-world {{who world}} {return "hello, $who"}
+                namespace eval child {
+                    proc add {a b} {expr {$a + $b}}
+                }
+            }"""
+        )
+        tcl = tohil.import_tcl()
+        lazy_test = tcl.lazy_test
+        self.assertIsInstance(lazy_test, tohil.TclNamespace)
+        self.assertEqual(lazy_test.__tohil_procs__, {})
+
+        self.assertEqual(lazy_test.hello_world(to=str), "hello, world")
+        self.assertEqual(list(lazy_test.__tohil_procs__), ["::lazy_test::hello-world"])
+        self.assertIs(lazy_test.hello_world, lazy_test.__tohil_functions__["hello_world"])
+        self.assertEqual(lazy_test.child.add(2, 3, to=int), 5)
+
+        self.assertIn("hello_world", dir(lazy_test))
+        self.assertIn("child", dir(lazy_test))
+
+        with self.assertRaises(AttributeError):
+            lazy_test.no_such_proc
+
+    def test_namespace2(self):
+        """new procs are found, and prefetch imports up front"""
+        tohil.eval("namespace eval ::lazy_test2 {proc one {} {return 1}}")
+        ns = tohil.TclNamespace("::lazy_test2", prefetch=["one"])
+        self.assertIn("one", ns.__dict__)
+
+        tohil.eval("proc ::lazy_test2::two {} {return 2}")
+        self.assertEqual(ns.two(to=int), 2)
+
+        tohil.eval("namespace eval ::lazy_test2::sub {proc three {} {return 3}}")
+        ns.__tohil_prefetch__("sub.three")
+        self.assertIn("three", ns.sub.__dict__)
+
+        with self.assertRaises(AttributeError):
+            ns.__tohil_prefetch__("sub.four")
+
+        # a proc named prefetch isn't hidden
+        tohil.eval("proc ::lazy_test2::prefetch {} {return 4}")
+        self.assertEqual(ns.prefetch(to=int), 4)
+
+        # a command that goes away after the namespace was listed
+        # is an AttributeError, not a NameError
+        tohil.eval("proc ::lazy_test2::five {} {return 5}")
+        self.assertIn("five", ns.__tohil_load_names__())
+        tohil.eval("rename ::lazy_test2::five {}")
+        self.assertIsNone(getattr(ns, "five", None))
+        self.assertFalse(hasattr(ns, "five"))
+
 
 # add support for to =; be able to coerce output
 